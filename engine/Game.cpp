@@ -6,7 +6,10 @@ namespace nemo
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 
-Game::Game()
+Game::Game(ActionMap& map, const bool headless)
+	: running_    (true)
+	, animating_  (false)
+	, menu_player_(map, headless)
 {
 }
 
@@ -28,13 +31,53 @@ Game::resume()
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 
+bool
+Game::paused()
+const noexcept
+{
+	return !running_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+Game::animating()
+const noexcept
+{
+	return animating_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
 void
 Game::update(
-	const std::optional<KeyAction> key, 
-	sf::RenderWindow& window)
+	const std::vector<TimedInput>& inputs, 
+	[[maybe_unused]] const ActionState& actions)
+{
+	if (!running_) {
+		return;
+	}
+
+	// Menus only change on player input.
+	animating_ = !inputs.empty();
+
+	if (menu_player_.menuIsOpened()) {
+		menu_player_.update(inputs);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+Game::draw(RenderList& list, [[maybe_unused]] const float alpha)
+const
 {
+	// Menus don't move between steps, so there is nothing to interpolate yet.
 	if (menu_player_.menuIsOpened()) {
-		menu_player_.update(key, window);
+		menu_player_.draw(list);
 	}
 }
 
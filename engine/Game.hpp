@@ -1,11 +1,12 @@
 #pragma once
 
-#include <optional>
-#include <memory>
-#include <SFML/Graphics/RenderWindow.hpp>
+#include <vector>
 
+#include "key/ActionMap.hpp"
+#include "key/ActionState.hpp"
+#include "loop/InputQueue.hpp"
 #include "player/MenuPlayer.hpp"
-#include "utility/type/Key.hpp"
+#include "render/RenderList.hpp"
 
 namespace nemo
 {
@@ -15,8 +16,13 @@ class Game
 public:
 	/***
 	 * @brief Construct the game.
+	 * 
+	 * @param map         - Key bindings, whose context follows what the game 
+	 *                      shows. Must outlive the game.
+	 * @param headless    - Whether to run without a graphics context, e.g. 
+	 *                      with a @class NullBackend.
 	 ***/
-	Game();
+	Game(ActionMap& map, const bool headless);
 
 	/***
 	 * @brief Pause the game.
@@ -31,18 +37,52 @@ public:
 	resume();
 
 	/***
-	 * @brief Process a frame in the game.
+	 * @brief Indicates whether the game is paused.
 	 * 
-	 * @param key         - Player input.
-	 * @param window      - Render window.
+	 * @return True if yes, false otherwise.
+	 ***/
+	bool
+	paused()
+	const noexcept;
+
+	/***
+	 * @brief Indicates whether the screen changed in the last simulation step, 
+	 * so that the game loop knows whether it can slow down.
+	 * 
+	 * @return True if yes, false otherwise.
+	 ***/
+	bool
+	animating()
+	const noexcept;
+
+	/***
+	 * @brief Advance the game by one fixed simulation step. Does nothing while 
+	 * the game is paused.
+	 * 
+	 * @param inputs      - Controls pressed during the step, oldest first, 
+	 *                      then the ones repeated by being held.
+	 * @param actions     - Controls pressed, held, and released, for things 
+	 *                      that act as long as a key is down.
 	 ***/
 	void 
 	update(
-		const std::optional<KeyAction> key, 
-		sf::RenderWindow& window);
+		const std::vector<TimedInput>& inputs, 
+		const ActionState& actions);
+
+	/***
+	 * @brief Record the current state of the game into a render list.
+	 * 
+	 * @param list        - Render list for the current frame.
+	 * @param alpha       - How far, from 0 to 1, the frame is between the 
+	 *                      previous simulation step and the current one.
+	 ***/
+	void
+	draw(RenderList& list, const float alpha)
+	const;
 
 private:
-	bool running_;
+	bool running_;   ///< The game isn't paused.
+	bool animating_; ///< The last step changed what is on screen.
 	MenuPlayer menu_player_;
 };
 
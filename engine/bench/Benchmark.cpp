@@ -0,0 +1,57 @@
+#include <array>
+#include <utility>
+
+#include "Benchmark.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	using BenchmarkFn = bool (*)(std::ostream&);
+
+	// Add new benchmarks here.
+	const std::array benchmarks = {
+		std::pair<const char*, BenchmarkFn>{ "jobs", benchJobSystem },
+		std::pair<const char*, BenchmarkFn>{ "ecs", benchEcs },
+		std::pair<const char*, BenchmarkFn>{ "dispatch", benchStaticDispatch },
+		std::pair<const char*, BenchmarkFn>{ "pool", benchPool },
+		std::pair<const char*, BenchmarkFn>{ "spatial", benchSpatial },
+		std::pair<const char*, BenchmarkFn>{ "simd", benchSimdPhysics },
+		std::pair<const char*, BenchmarkFn>{ "broadphase", benchBroadphase },
+		std::pair<const char*, BenchmarkFn>{ "staged", benchStagedUpdate },
+		std::pair<const char*, BenchmarkFn>{ "batch", benchSpriteBatch },
+		std::pair<const char*, BenchmarkFn>{ "queue", benchRenderQueue },
+		std::pair<const char*, BenchmarkFn>{ "convert", benchKeyControls },
+		std::pair<const char*, BenchmarkFn>{ "settings", benchSettings },
+	};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+runBenchmark(const std::string& name, std::ostream& os)
+{
+	auto found = false;
+	auto passed = true;
+
+	// Run every selected benchmark even after one fails, so that all failures 
+	// show up in one run.
+	for (const auto& [bench_name, bench] : benchmarks) {
+		if (name == "all" || name == bench_name) {
+			os << "== " << bench_name << " ==" << std::endl;
+			passed = bench(os) && passed;
+			found = true;
+		}
+	}
+
+	return found && passed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+
+namespace nemo
+{
+
+/***
+ * @brief Run one of the engine's microbenchmarks, or all of them.
+ * 
+ * Benchmarks don't need a window. They are run from the command line with 
+ * `--bench <name>`, and print their results to @p os. Besides timing, most 
+ * of them check their result against a reference, so a run also tests.
+ * 
+ * @param name        - Name of the benchmark, or "all".
+ * @param os          - Stream to print results to.
+ * 
+ * @return True if a benchmark with that name exists and every benchmark run 
+ * passed its checks, false otherwise.
+ ***/
+bool
+runBenchmark(const std::string& name, std::ostream& os);
+
+/***
+ * @brief Benchmarks. Each lives in its own file in this directory, and 
+ * returns false if its result doesn't match the reference.
+ ***/
+bool benchJobSystem(std::ostream& os);
+bool benchEcs(std::ostream& os);
+bool benchStaticDispatch(std::ostream& os);
+bool benchPool(std::ostream& os);
+bool benchSpatial(std::ostream& os);
+bool benchSimdPhysics(std::ostream& os);
+bool benchBroadphase(std::ostream& os);
+bool benchStagedUpdate(std::ostream& os);
+bool benchSpriteBatch(std::ostream& os);
+bool benchRenderQueue(std::ostream& os);
+bool benchKeyControls(std::ostream& os);
+bool benchSettings(std::ostream& os);
+
+}
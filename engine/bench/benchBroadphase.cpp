@@ -0,0 +1,128 @@
+#include <random>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "physics/Broadphase.hpp"
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	constexpr std::size_t n_bodies = 5'000;
+	constexpr std::size_t n_moving = n_bodies / 10;
+	constexpr auto n_frames = 200;
+	constexpr auto world_size = 2000.f;
+
+	struct Body
+	{
+		Aabb  box_;
+		float vx_, vy_;
+	};
+
+	void
+	step(Body& b)
+	noexcept
+	{
+		b.box_.min_x_ += b.vx_;
+		b.box_.max_x_ += b.vx_;
+		b.box_.min_y_ += b.vy_;
+		b.box_.max_y_ += b.vy_;
+
+		if (b.box_.min_x_ < 0.f || b.box_.max_x_ > world_size) {
+			b.vx_ = -b.vx_;
+		}
+		if (b.box_.min_y_ < 0.f || b.box_.max_y_ > world_size) {
+			b.vy_ = -b.vy_;
+		}
+	}
+
+	std::vector<ColliderPair>
+	bruteForce(const std::vector<Body>& bodies)
+	{
+		std::vector<ColliderPair> pairs;
+		for (std::size_t i = 0; i < bodies.size(); ++i) {
+			for (auto j = i + 1; j < bodies.size(); ++j) {
+				if (bodies[i].box_.overlaps(bodies[j].box_)) {
+					pairs.push_back({ ColliderId(i), ColliderId(j) });
+				}
+			}
+		}
+		return pairs;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+benchBroadphase(std::ostream& os)
+{
+	using ms = std::chrono::duration<double, std::milli>;
+
+	std::mt19937 rng(7);
+	std::uniform_real_distribution<float> coord(0.f, world_size - 32.f);
+	std::uniform_real_distribution<float> extent(8.f, 32.f);
+	std::uniform_real_distribution<float> speed(-2.f, 2.f);
+
+	std::vector<Body> bodies(n_bodies);
+	SweepAndPrune sap;
+
+	for (std::size_t i = 0; i < n_bodies; ++i) {
+		const auto x = coord(rng);
+		const auto y = coord(rng);
+		bodies[i].box_ = { x, y, x + extent(rng), y + extent(rng) };
+		bodies[i].vx_ = i < n_moving ? speed(rng) : 0.f;
+		bodies[i].vy_ = i < n_moving ? speed(rng) : 0.f;
+		sap.insert(ColliderId(i), bodies[i].box_);
+	}
+
+	os << n_bodies << " bodies, " << n_moving << " moving, " << n_frames 
+		<< " frames" << std::endl;
+
+	auto start = SteadyClock::now();
+	const auto first_ok = sap.findPairs() == bruteForce(bodies);
+	const auto first = ms(SteadyClock::now() - start).count();
+
+	auto sap_time = Duration::zero();
+	auto pairs = std::size_t(0);
+	auto moves = std::size_t(0);
+
+	for (auto frame = 0; frame < n_frames; ++frame) {
+		for (std::size_t i = 0; i < n_moving; ++i) {
+			step(bodies[i]);
+			sap.update(ColliderId(i), bodies[i].box_);
+		}
+
+		start = SteadyClock::now();
+		pairs += sap.findPairs().size();
+		sap_time += SteadyClock::now() - start;
+		moves += sap.lastSortMoves();
+	}
+
+	start = SteadyClock::now();
+	const auto expected = bruteForce(bodies);
+	const auto brute = ms(SteadyClock::now() - start).count();
+	const auto last_ok = sap.findPairs() == expected;
+
+	os << "first frame (with brute-force check): " << first << " ms" << std::endl
+		<< "sweep and prune: " << ms(sap_time).count() / n_frames 
+		<< " ms/frame, " << pairs / n_frames << " pairs, " 
+		<< moves / n_frames << " sort moves" << std::endl
+		<< "brute force: " << brute << " ms/frame" << std::endl;
+
+	if (!first_ok || !last_ok) {
+		os << "MISMATCH with brute force" << std::endl;
+		return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
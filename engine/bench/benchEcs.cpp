@@ -0,0 +1,108 @@
+#include <memory>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "ecs/Components.hpp"
+#include "ecs/Systems.hpp"
+#include "ecs/World.hpp"
+#include "object/GameObject.hpp"
+#include "object/Graphics.hpp"
+#include "object/Input.hpp"
+#include "object/Physics.hpp"
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	constexpr std::size_t n_entities = 100'000;
+	constexpr auto n_frames = 100;
+	constexpr auto dt = 1.f / 60.f;
+
+	// The same movement as @property integrate, done through the virtual 
+	// Physics component of a GameObject.
+	class VelocityPhysics : public Physics
+	{
+	public:
+		VelocityPhysics(const float vx, const float vy)
+			: vx_(vx)
+			, vy_(vy)
+		{
+		}
+
+		void
+		update(GameObject& obj)
+		override
+		{
+			const auto pos = obj.getPosition();
+			obj.setPosition({ 
+				XValue(float(pos.x_) + vx_ * dt), 
+				YValue(float(pos.y_) + vy_ * dt) 
+			});
+		}
+
+	private:
+		float vx_;
+		float vy_;
+	};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+benchEcs(std::ostream& os)
+{
+	using ms = std::chrono::duration<double, std::milli>;
+
+	os << n_entities << " entities, " << n_frames << " frames" << std::endl;
+
+	// Current path: one GameObject per entity, updated one by one.
+	std::vector<std::unique_ptr<GameObject>> objects;
+	objects.reserve(n_entities);
+	for (std::size_t i = 0; i < n_entities; ++i) {
+		objects.push_back(std::make_unique<GameObject>(
+			XYPair(XValue(float(i % 1000)), YValue(float(i / 1000))),
+			nullptr,
+			std::make_unique<VelocityPhysics>(1.f, float(i % 7)),
+			nullptr
+		));
+	}
+
+	auto start = SteadyClock::now();
+	for (auto frame = 0; frame < n_frames; ++frame) {
+		for (auto& obj : objects) {
+			obj->update(KeyAction::count); // No Input, so unused.
+		}
+	}
+	const auto legacy = ms(SteadyClock::now() - start).count() / n_frames;
+
+	// ECS path: the same movement as a system over contiguous arrays.
+	World world;
+	for (std::size_t i = 0; i < n_entities; ++i) {
+		world.create(
+			Position{ float(i % 1000), float(i / 1000) }, 
+			Velocity{ 1.f, float(i % 7) }
+		);
+	}
+
+	start = SteadyClock::now();
+	for (auto frame = 0; frame < n_frames; ++frame) {
+		integrate(world, dt);
+	}
+	const auto ecs = ms(SteadyClock::now() - start).count() / n_frames;
+
+	os << "GameObject::update: " << legacy << " ms/frame" << std::endl
+		<< "ECS integrate: " << ecs << " ms/frame, "
+		<< "speedup " << legacy / ecs << "x" << std::endl;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
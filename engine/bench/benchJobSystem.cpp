@@ -0,0 +1,93 @@
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "job/JobSystem.hpp"
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	constexpr std::size_t n_objects = 100'000;
+	constexpr auto n_frames = 30;
+
+	// Stand-in for a game object with a bit of steering and movement logic.
+	struct Body
+	{
+		float x_, y_;
+		float vx_, vy_;
+	};
+
+	void
+	steer(Body& b)
+	noexcept
+	{
+		// Chase a target on a circle, a few iterations to have something 
+		// worth splitting across threads.
+		for (auto i = 0; i < 8; ++i) {
+			const auto tx = std::cos(b.x_ * 0.01f) * 100.f - b.x_;
+			const auto ty = std::sin(b.y_ * 0.01f) * 100.f - b.y_;
+			const auto len = std::sqrt(tx * tx + ty * ty) + 1.f;
+			b.vx_ += tx / len * 0.1f;
+			b.vy_ += ty / len * 0.1f;
+			b.x_ += b.vx_ * 0.016f;
+			b.y_ += b.vy_ * 0.016f;
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+benchJobSystem(std::ostream& os)
+{
+	using ms = std::chrono::duration<double, std::milli>;
+
+	const auto max_threads = std::max(1u, std::thread::hardware_concurrency());
+	auto single = 0.0;
+
+	os << n_objects << " objects, " << n_frames << " frames" << std::endl;
+
+	for (auto threads = 1u; threads <= max_threads; ++threads) {
+		JobSystem jobs(threads);
+
+		std::vector<Body> bodies(n_objects);
+		for (std::size_t i = 0; i < bodies.size(); ++i) {
+			bodies[i] = { float(i % 1000), float(i / 1000), 0.f, 0.f };
+		}
+
+		const auto start = SteadyClock::now();
+
+		for (auto frame = 0; frame < n_frames; ++frame) {
+			jobs.parallelFor(bodies.size(), 0, 
+				[&bodies](const std::size_t first, const std::size_t last) {
+					for (auto i = first; i < last; ++i) {
+						steer(bodies[i]);
+					}
+				}
+			);
+		}
+
+		const auto per_frame = ms(SteadyClock::now() - start).count() / n_frames;
+		if (threads == 1) {
+			single = per_frame;
+		}
+
+		os << threads << " threads: " 
+			<< per_frame << " ms/frame, "
+			<< "speedup " << single / per_frame << "x" << std::endl;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
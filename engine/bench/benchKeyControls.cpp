@@ -0,0 +1,132 @@
+#include <functional>
+#include <optional>
+#include <random>
+#include <vector>
+#include <boost/container/flat_map.hpp>
+#include <SFML/Window/Keyboard.hpp>
+
+#include "Benchmark.hpp"
+#include "key/ActionMap.hpp"
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	constexpr std::size_t n_events = 1'000'000;
+	constexpr auto n_runs = 20;
+
+	// The default keys, one per control.
+	constexpr std::pair<sf::Keyboard::Key, KeyAction> keys[] = {
+		{ sf::Keyboard::W,         KeyAction::Up     },
+		{ sf::Keyboard::S,         KeyAction::Down   },
+		{ sf::Keyboard::A,         KeyAction::Left   },
+		{ sf::Keyboard::D,         KeyAction::Right  },
+		{ sf::Keyboard::P,         KeyAction::Select },
+		{ sf::Keyboard::O,         KeyAction::Cancel },
+		{ sf::Keyboard::Backspace, KeyAction::Pause  },
+	};
+
+	// How the controls used to be stored.
+	using FlatMap = boost::container::flat_map<
+		Key, KeyAction, std::function<bool (const Key&, const Key&)>
+	>;
+
+	std::optional<KeyAction>
+	convert(const FlatMap& map, const Key& k)
+	noexcept
+	{
+		const auto it = map.find(k);
+		if (it == map.cend()) {
+			return {};
+		}
+
+		return { it->second };
+	}
+
+	// Sum of the actions found, so that the lookups can't be optimized away 
+	// and both versions can be compared.
+	template <typename Convert>
+	std::size_t
+	run(const std::vector<Key>& events, Convert&& convert)
+	{
+		auto sum = std::size_t(0);
+		for (const auto& k : events) {
+			const auto action = convert(k);
+			sum += action ? std::size_t(*action) + 1 : 0;
+		}
+
+		return sum;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+benchKeyControls(std::ostream& os)
+{
+	using ms = std::chrono::duration<double, std::milli>;
+
+	FlatMap flat([](const Key& a, const Key& b) { return a < b; });
+	ActionMap dense;
+	for (const auto& [key, action] : keys) {
+		flat[Key(key)] = action;
+		dense.bind(InputContext::Gameplay, action, Chord{ Key(key) });
+	}
+
+	// Mostly bound keys, as a player would press them, with some others.
+	std::mt19937 rng(11);
+	std::uniform_int_distribution<int> bound(0, std::size(keys) - 1);
+	std::uniform_int_distribution<int> any(0, sf::Keyboard::KeyCount - 1);
+	std::uniform_int_distribution<int> percent(0, 99);
+	std::vector<Key> events;
+	for (std::size_t i = 0; i < n_events; ++i) {
+		events.push_back(percent(rng) < 80 
+			? Key(keys[bound(rng)].first) 
+			: Key(sf::Keyboard::Key(any(rng))));
+	}
+
+	os << n_events << " key events, " << std::size(keys) 
+		<< " bound keys, best of " << n_runs << " runs" << std::endl;
+
+	auto flat_best = ms::max();
+	auto dense_best = ms::max();
+	auto flat_sum = std::size_t(0);
+	auto dense_sum = std::size_t(0);
+
+	for (auto r = 0; r < n_runs; ++r) {
+		auto start = SteadyClock::now();
+		flat_sum = run(events, [&flat](const Key& k) { 
+			return convert(flat, k); 
+		});
+		flat_best = std::min(flat_best, ms(SteadyClock::now() - start));
+
+		start = SteadyClock::now();
+		dense_sum = run(events, [&dense](const Key& k) { 
+			return dense.convert(k); 
+		});
+		dense_best = std::min(dense_best, ms(SteadyClock::now() - start));
+	}
+
+	const auto ok = flat_sum == dense_sum;
+	if (!ok) {
+		os << "MISMATCH between flat map and table: " 
+			<< flat_sum << " vs " << dense_sum << std::endl;
+	}
+
+	os << "flat map: " << flat_best.count() << " ms (" 
+		<< flat_best.count() * 1e6 / n_events << " ns/event)" << std::endl
+		<< "table: " << dense_best.count() << " ms (" 
+		<< dense_best.count() * 1e6 / n_events << " ns/event)" << std::endl;
+
+	return ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
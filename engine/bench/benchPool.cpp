@@ -0,0 +1,130 @@
+#include <memory>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "memory/BlockPool.hpp"
+#include "memory/Pool.hpp"
+#include "object/GameObject.hpp"
+#include "object/Graphics.hpp"
+#include "object/Input.hpp"
+#include "object/Physics.hpp"
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	constexpr std::size_t n_live = 10'000;
+	constexpr std::size_t n_churn = 1'000;
+	constexpr auto n_frames = 200;
+
+	class Projectile : public Physics
+	{
+	public:
+		void
+		update(GameObject& obj)
+		override
+		{
+			obj.setPosition(obj.getPosition() + XYPair(XValue(4.f)));
+		}
+	};
+
+	class PooledProjectile : public Physics, public Pooled<PooledProjectile>
+	{
+	public:
+		void
+		update(GameObject& obj)
+		override
+		{
+			obj.setPosition(obj.getPosition() + XYPair(XValue(4.f)));
+		}
+	};
+
+	XYPair
+	startOf(const std::size_t i)
+	{
+		return { XValue(float(i % 640)), YValue(float(i % 480)) };
+	}
+
+	void
+	report(std::ostream& os, const char* name, const PoolStats& stats)
+	{
+		os << name << ": " << stats.size_ << " live, " 
+			<< stats.capacity_ << " capacity, " 
+			<< stats.high_water_ << " high water" << std::endl;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+benchPool(std::ostream& os)
+{
+	using ms = std::chrono::duration<double, std::milli>;
+
+	os << n_live << " live objects, " << n_churn << " respawned per frame, " 
+		<< n_frames << " frames" << std::endl;
+
+	// Heap: every spawn allocates the object and its Physics.
+	std::vector<std::unique_ptr<GameObject>> heap(n_live);
+	auto next = std::size_t(0);
+
+	auto start = SteadyClock::now();
+	for (auto frame = 0; frame < n_frames; ++frame) {
+		for (std::size_t i = 0; i < n_churn; ++i, next = (next + 1) % n_live) {
+			heap[next] = std::make_unique<GameObject>(
+				startOf(next), nullptr, std::make_unique<Projectile>(), nullptr
+			);
+		}
+
+		for (auto& obj : heap) {
+			if (obj != nullptr) {
+				obj->update(KeyAction::count); // No Input, so unused.
+			}
+		}
+	}
+	const auto heap_ms = ms(SteadyClock::now() - start).count() / n_frames;
+
+	// Pools: spawns reuse the slots and blocks of despawned objects.
+	Pool<GameObject> pool;
+	std::vector<Handle<GameObject>> handles(n_live, Handle<GameObject>{ 0, 0 });
+	std::vector<bool> spawned(n_live, false);
+	next = 0;
+
+	start = SteadyClock::now();
+	for (auto frame = 0; frame < n_frames; ++frame) {
+		for (std::size_t i = 0; i < n_churn; ++i, next = (next + 1) % n_live) {
+			if (spawned[next]) {
+				pool.destroy(handles[next]);
+			}
+
+			handles[next] = pool.create(
+				startOf(next), 
+				nullptr, 
+				std::make_unique<PooledProjectile>(), 
+				nullptr
+			);
+			spawned[next] = true;
+		}
+
+		pool.each([](GameObject& obj) { obj.update(KeyAction::count); });
+	}
+	const auto pool_ms = ms(SteadyClock::now() - start).count() / n_frames;
+
+	os << "heap: " << heap_ms << " ms/frame" << std::endl
+		<< "pool: " << pool_ms << " ms/frame, "
+		<< "speedup " << heap_ms / pool_ms << "x" << std::endl;
+	report(os, "objects", pool.stats());
+	report(os, "physics", PooledProjectile::pool().stats());
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,165 @@
+#include <array>
+#include <random>
+#include <vector>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include "Benchmark.hpp"
+#include "render/NullBackend.hpp"
+#include "render/RenderQueue.hpp"
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	constexpr std::size_t n_commands = 10'000;
+	constexpr auto n_textures = 8;
+	constexpr auto n_fonts = 2;
+	constexpr auto n_layers = 4;
+	constexpr auto n_rows = 8;
+	constexpr auto row_height = 90.f;
+	constexpr auto n_frames = 50;
+
+	struct Queued
+	{
+		const void*  resource_;
+		std::uint8_t layer_;
+		float        depth_;
+		bool         text_;
+		std::size_t  index_;
+	};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+benchRenderQueue(std::ostream& os)
+{
+	using ms = std::chrono::duration<double, std::milli>;
+
+	// The textures and fonts are never loaded; the null backend doesn't look 
+	// at them.
+	std::array<sf::Texture, n_textures> textures;
+	std::array<sf::Font, n_fonts> fonts;
+	std::mt19937 rng(5);
+	std::uniform_int_distribution<int> texture(0, n_textures - 1);
+	std::uniform_int_distribution<int> font(0, n_fonts - 1);
+	std::uniform_int_distribution<int> layer(0, n_layers - 1);
+	std::uniform_int_distribution<int> kind(0, 9);
+	std::uniform_int_distribution<int> row(0, n_rows - 1);
+	std::uniform_real_distribution<float> coord(0.f, 720.f);
+
+	// One text for every nine sprites, in the order objects would draw them.
+	std::vector<sf::Sprite> sprites;
+	std::vector<sf::Text> texts;
+	std::vector<Queued> queued;
+	for (std::size_t i = 0; i < n_commands; ++i) {
+		// Depths are quantised to rows, as a continuous depth would leave 
+		// nothing with the same depth and texture to batch.
+		const auto l = std::uint8_t(layer(rng));
+		const auto depth = float(row(rng)) * row_height;
+
+		if (kind(rng) == 0) {
+			sf::Text text;
+			text.setFont(fonts[font(rng)]);
+			text.setPosition(coord(rng), depth);
+			queued.push_back({ text.getFont(), l, depth, true, texts.size() });
+			texts.push_back(text);
+		}
+		else {
+			sf::Sprite sprite(textures[texture(rng)], sf::IntRect(0, 0, 32, 32));
+			sprite.setPosition(coord(rng), depth);
+			queued.push_back(
+				{ sprite.getTexture(), l, depth, false, sprites.size() }
+			);
+			sprites.push_back(sprite);
+		}
+	}
+
+	os << n_commands << " commands on " << n_layers << " layers with " 
+		<< n_textures << " textures and " << n_fonts << " fonts, " 
+		<< n_frames << " frames" << std::endl;
+
+	// In the order they were made, every change of texture is a bind.
+	auto unsorted_binds = std::size_t(0);
+	const void* bound = nullptr;
+	for (const auto& q : queued) {
+		if (q.resource_ != bound) {
+			++unsorted_binds;
+			bound = q.resource_;
+		}
+	}
+
+	NullBackend unsorted_backend;
+	RenderList list;
+	auto start = SteadyClock::now();
+
+	for (auto frame = 0; frame < n_frames; ++frame) {
+		list.clear();
+		for (const auto& q : queued) {
+			if (q.text_) {
+				list.draw(texts[q.index_]);
+			}
+			else {
+				list.draw(sprites[q.index_]);
+			}
+		}
+		list.submit(unsorted_backend);
+	}
+
+	const auto unsorted = ms(SteadyClock::now() - start).count() / n_frames;
+
+	NullBackend sorted_backend;
+	RenderQueue queue;
+	auto flush_time = ms(0);
+	start = SteadyClock::now();
+
+	for (auto frame = 0; frame < n_frames; ++frame) {
+		list.clear();
+		for (const auto& q : queued) {
+			if (q.text_) {
+				queue.push(texts[q.index_], q.layer_, q.depth_);
+			}
+			else {
+				queue.push(sprites[q.index_], q.layer_, q.depth_);
+			}
+		}
+
+		const auto flush_start = SteadyClock::now();
+		queue.flush(list);
+		flush_time += SteadyClock::now() - flush_start;
+		list.submit(sorted_backend);
+	}
+
+	const auto sorted = ms(SteadyClock::now() - start).count() / n_frames;
+	const auto stats = queue.stats();
+
+	const auto ok = stats.commands_ == n_commands 
+		&& stats.binds_ <= stats.draws_ 
+		&& stats.binds_ < unsorted_binds;
+	if (!ok) {
+		os << "MISMATCH in queue stats" << std::endl;
+	}
+
+	os << "unsorted: " << unsorted_backend.drawCount() / n_frames 
+		<< " draws/frame, " << unsorted_binds << " binds/frame, " 
+		<< unsorted << " ms/frame" << std::endl
+		<< "queued: " << sorted_backend.drawCount() / n_frames 
+		<< " draws/frame, " << stats.binds_ << " binds/frame, " 
+		<< sorted << " ms/frame (sort and merge " 
+		<< flush_time.count() / n_frames << " ms/frame)" << std::endl;
+
+	return ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
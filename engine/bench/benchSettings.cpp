@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+
+#include "Benchmark.hpp"
+#include "settings/SettingsService.hpp"
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	constexpr auto n_changes = 200;
+	constexpr auto n_keys = 64;
+
+	// About the size of the controls document.
+	nlohmann::json
+	document(const int change)
+	{
+		nlohmann::json js;
+		for (auto k = 0; k < n_keys; ++k) {
+			js["key" + std::to_string(k)] = (k + change) % 101;
+		}
+
+		return js;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+benchSettings(std::ostream& os)
+{
+	using ms = std::chrono::duration<double, std::milli>;
+	namespace fs = std::filesystem;
+
+	const auto directory = fs::temp_directory_path() / "nemo-bench-settings";
+	fs::create_directories(directory);
+
+	os << n_changes << " changes to one document, as when states come and go" 
+		<< std::endl;
+
+	// Writing the file on the calling thread every time, as ~KeyControls used 
+	// to.
+	auto sync_total = ms(0);
+	auto sync_worst = ms(0);
+	for (auto c = 0; c < n_changes; ++c) {
+		const auto start = SteadyClock::now();
+		std::ofstream ofs(directory / "sync.json");
+		ofs << std::setw(4) << document(c) << std::endl;
+		ofs.close();
+
+		const auto elapsed = ms(SteadyClock::now() - start);
+		sync_total += elapsed;
+		sync_worst = std::max(sync_worst, elapsed);
+	}
+
+	// Storing in the service, which saves in the background.
+	auto service_total = ms(0);
+	auto service_worst = ms(0);
+	auto writes = std::size_t(0);
+	auto ok = true;
+	{
+		SettingsService settings(directory.string());
+		for (auto c = 0; c < n_changes; ++c) {
+			const auto js = document(c / 4); // Some changes change nothing.
+			const auto start = SteadyClock::now();
+			settings.store("async", js);
+
+			const auto elapsed = ms(SteadyClock::now() - start);
+			service_total += elapsed;
+			service_worst = std::max(service_worst, elapsed);
+		}
+
+		settings.flush();
+		writes = settings.writeCount();
+
+		std::ifstream ifs(directory / "async.json");
+		nlohmann::json saved;
+		ifs >> saved;
+		if (saved != document((n_changes - 1) / 4)) {
+			ok = false;
+			os << "MISMATCH between the last change and the saved file" 
+				<< std::endl;
+		}
+	}
+
+	fs::remove_all(directory);
+
+	os << "synchronous: " << n_changes << " writes, " 
+		<< sync_total.count() / n_changes << " ms/change, worst " 
+		<< sync_worst.count() << " ms" << std::endl
+		<< "service: " << writes << " writes, " 
+		<< service_total.count() / n_changes << " ms/change, worst " 
+		<< service_worst.count() << " ms" << std::endl;
+
+	return ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,151 @@
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "object/GameObject.hpp"
+#include "object/Graphics.hpp"
+#include "object/Input.hpp"
+#include "object/Physics.hpp"
+#include "physics/KinematicBodies.hpp"
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	constexpr std::size_t n_bodies = 100'000;
+	constexpr auto n_steps = 200;
+	constexpr auto dt = 1.f / 60.f;
+
+	// The same integration, one virtual call per object.
+	class KinematicPhysics : public Physics
+	{
+	public:
+		KinematicPhysics(const float vx, const float vy, const float ay)
+			: vx_(vx)
+			, vy_(vy)
+			, ay_(ay)
+		{
+		}
+
+		void
+		update(GameObject& obj)
+		override
+		{
+			vy_ = vy_ + ay_ * dt;
+			const auto pos = obj.getPosition();
+			obj.setPosition({ 
+				XValue(float(pos.x_) + vx_ * dt), 
+				YValue(float(pos.y_) + vy_ * dt) 
+			});
+		}
+
+	private:
+		float vx_;
+		float vy_;
+		float ay_;
+	};
+
+	XYPair
+	startOf(const std::size_t i)
+	{
+		return { XValue(float(i % 1000)), YValue(float(i / 1000)) };
+	}
+
+	XYPair
+	velocityOf(const std::size_t i)
+	{
+		return { XValue(float(i % 13) - 6.f), YValue(float(i % 7) * 0.37f) };
+	}
+
+	XYPair
+	accelOf(const std::size_t)
+	{
+		return { XValue(0.f), YValue(9.81f) };
+	}
+
+	double
+	perMs(const Duration elapsed)
+	{
+		using ms = std::chrono::duration<double, std::milli>;
+		return double(n_bodies) * n_steps / ms(elapsed).count();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+benchSimdPhysics(std::ostream& os)
+{
+	os << n_bodies << " bodies, " << n_steps << " steps, best available: " 
+		<< simdName(detectSimd()) << std::endl;
+
+	{
+		std::vector<std::unique_ptr<GameObject>> objects;
+		for (std::size_t i = 0; i < n_bodies; ++i) {
+			const auto vel = velocityOf(i);
+			objects.push_back(std::make_unique<GameObject>(
+				startOf(i), 
+				nullptr, 
+				std::make_unique<KinematicPhysics>(
+					float(vel.x_), float(vel.y_), float(accelOf(i).y_)), 
+				nullptr
+			));
+		}
+
+		const auto start = SteadyClock::now();
+		for (auto s = 0; s < n_steps; ++s) {
+			for (auto& obj : objects) {
+				obj->update(KeyAction::count); // No Input, so unused.
+			}
+		}
+
+		os << "GameObject (virtual): " << perMs(SteadyClock::now() - start) 
+			<< " entities/ms" << std::endl;
+	}
+
+	std::vector<float> reference;
+	auto ok = true;
+
+	for (auto level = SimdLevel::Scalar; level <= detectSimd(); 
+		level = SimdLevel(int(level) + 1)) {
+		KinematicBodies bodies(level);
+		for (std::size_t i = 0; i < n_bodies; ++i) {
+			bodies.add(startOf(i), velocityOf(i), accelOf(i));
+		}
+
+		const auto start = SteadyClock::now();
+		for (auto s = 0; s < n_steps; ++s) {
+			bodies.integrate(dt);
+		}
+		const auto elapsed = SteadyClock::now() - start;
+
+		os << simdName(level) << ": " << perMs(elapsed) << " entities/ms";
+
+		// Every kernel must match the scalar one bit for bit.
+		auto result = bodies.xs();
+		result.insert(result.end(), bodies.ys().begin(), bodies.ys().end());
+		if (reference.empty()) {
+			reference = std::move(result);
+		}
+		else if (std::memcmp(result.data(), reference.data(), 
+			reference.size() * sizeof(float)) != 0) {
+			os << ", MISMATCH with scalar";
+			ok = false;
+		}
+
+		os << std::endl;
+	}
+
+	return ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
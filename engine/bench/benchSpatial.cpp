@@ -0,0 +1,210 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "spatial/LooseQuadtree.hpp"
+#include "spatial/SpatialGrid.hpp"
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	constexpr std::size_t n_objects = 50'000;
+	constexpr std::size_t n_queries = 1'000;
+	constexpr auto n_frames = 30;
+	constexpr auto world_size = 8192.f;
+	constexpr auto query_radius = 64.f;
+
+	struct Mover
+	{
+		float x_, y_;
+		float vx_, vy_;
+	};
+
+	std::vector<Mover>
+	makeMovers(const bool clustered)
+	{
+		std::mt19937 rng(42);
+		std::uniform_real_distribution<float> uniform(0.f, world_size);
+		std::uniform_real_distribution<float> speed(-4.f, 4.f);
+		std::normal_distribution<float> spread(0.f, 150.f);
+
+		std::vector<XYPair> centers;
+		for (auto i = 0; i < 8; ++i) {
+			centers.emplace_back(XValue(uniform(rng)), YValue(uniform(rng)));
+		}
+
+		std::vector<Mover> movers(n_objects);
+		for (std::size_t i = 0; i < n_objects; ++i) {
+			auto& m = movers[i];
+			if (clustered) {
+				const auto& c = centers[i % centers.size()];
+				m.x_ = std::clamp(float(c.x_) + spread(rng), 0.f, world_size);
+				m.y_ = std::clamp(float(c.y_) + spread(rng), 0.f, world_size);
+			}
+			else {
+				m.x_ = uniform(rng);
+				m.y_ = uniform(rng);
+			}
+			m.vx_ = speed(rng);
+			m.vy_ = speed(rng);
+		}
+
+		return movers;
+	}
+
+	void
+	step(Mover& m)
+	noexcept
+	{
+		m.x_ += m.vx_;
+		m.y_ += m.vy_;
+		if (m.x_ < 0.f || m.x_ > world_size) {
+			m.vx_ = -m.vx_;
+			m.x_ = std::clamp(m.x_, 0.f, world_size);
+		}
+		if (m.y_ < 0.f || m.y_ > world_size) {
+			m.vy_ = -m.vy_;
+			m.y_ = std::clamp(m.y_, 0.f, world_size);
+		}
+	}
+
+	XYPair
+	positionOf(const Mover& m)
+	{
+		return { XValue(m.x_), YValue(m.y_) };
+	}
+
+	// Number of queries whose result differs from a linear scan.
+	std::size_t
+	verify(const SpatialIndex& index, const std::vector<Mover>& movers)
+	{
+		auto mismatches = std::size_t(0);
+		std::vector<SpatialId> found;
+
+		for (std::size_t q = 0; q < 20; ++q) {
+			const auto& center = movers[q * 997 % movers.size()];
+			found.clear();
+			index.queryRadius(positionOf(center), query_radius, found);
+			std::sort(found.begin(), found.end());
+
+			std::vector<SpatialId> expected;
+			for (std::size_t i = 0; i < movers.size(); ++i) {
+				const auto dx = movers[i].x_ - center.x_;
+				const auto dy = movers[i].y_ - center.y_;
+				if (dx * dx + dy * dy <= query_radius * query_radius) {
+					expected.push_back(SpatialId(i));
+				}
+			}
+
+			mismatches += found != expected ? 1 : 0;
+		}
+
+		return mismatches;
+	}
+
+	bool
+	run(std::ostream& os, const char* name, SpatialIndex& index, 
+		std::vector<Mover> movers)
+	{
+		using ms = std::chrono::duration<double, std::milli>;
+		using us = std::chrono::duration<double, std::micro>;
+
+		for (std::size_t i = 0; i < movers.size(); ++i) {
+			index.insert(SpatialId(i), positionOf(movers[i]));
+		}
+
+		auto move_time = Duration::zero();
+		auto radius_time = Duration::zero();
+		auto rect_time = Duration::zero();
+		auto found_total = std::size_t(0);
+		std::vector<SpatialId> found;
+
+		for (auto frame = 0; frame < n_frames; ++frame) {
+			auto start = SteadyClock::now();
+			for (std::size_t i = 0; i < movers.size(); ++i) {
+				step(movers[i]);
+				index.move(SpatialId(i), positionOf(movers[i]));
+			}
+			move_time += SteadyClock::now() - start;
+
+			start = SteadyClock::now();
+			for (std::size_t q = 0; q < n_queries; ++q) {
+				found.clear();
+				const auto& center = movers[q * 37 % movers.size()];
+				index.queryRadius(positionOf(center), query_radius, found);
+				found_total += found.size();
+			}
+			radius_time += SteadyClock::now() - start;
+
+			start = SteadyClock::now();
+			for (std::size_t q = 0; q < n_queries; ++q) {
+				found.clear();
+				const auto& corner = movers[q * 53 % movers.size()];
+				index.queryRect(
+					positionOf(corner), 
+					XYPair(
+						XValue(corner.x_ + 2.f * query_radius), 
+						YValue(corner.y_ + 2.f * query_radius)
+					), 
+					found
+				);
+			}
+			rect_time += SteadyClock::now() - start;
+		}
+
+		const auto n = double(n_frames * n_queries);
+		os << name << ": move " << ms(move_time).count() / n_frames 
+			<< " ms/frame, radius " << us(radius_time).count() / n 
+			<< " us/query (" << double(found_total) / n << " found), rect " 
+			<< us(rect_time).count() / n << " us/query";
+
+		const auto bad = verify(index, movers);
+		if (bad != 0) {
+			os << ", MISMATCH in " << bad << " queries";
+		}
+
+		os << std::endl;
+		return bad == 0;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+benchSpatial(std::ostream& os)
+{
+	os << n_objects << " moving objects, " << n_queries 
+		<< " radius and rect queries per frame, " << n_frames << " frames" 
+		<< std::endl;
+
+	auto ok = true;
+
+	for (const auto clustered : { false, true }) {
+		os << (clustered ? "clustered:" : "uniform:") << std::endl;
+		const auto movers = makeMovers(clustered);
+
+		SpatialGrid grid(2.f * query_radius);
+		ok = run(os, "  grid", grid, movers) && ok;
+
+		const XYPair world_min;
+		const auto world_max = XYPair(XValue(world_size), YValue(world_size));
+		LooseQuadtree tree(world_min, world_max);
+		ok = run(os, "  loose quadtree", tree, movers) && ok;
+		os << "  quadtree nodes: " << tree.nodeCount() << std::endl;
+	}
+
+	return ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,115 @@
+#include <array>
+#include <random>
+#include <vector>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include "Benchmark.hpp"
+#include "render/NullBackend.hpp"
+#include "render/RenderList.hpp"
+#include "render/SpriteBatcher.hpp"
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	constexpr std::size_t n_sprites = 10'000;
+	constexpr auto n_atlases = 4;
+	constexpr auto n_layers = 3;
+	constexpr auto n_frames = 50;
+
+	struct Placed
+	{
+		AtlasRegion  region_;
+		XYPair       pos_;
+		std::int32_t layer_;
+	};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+benchSpriteBatch(std::ostream& os)
+{
+	using ms = std::chrono::duration<double, std::milli>;
+
+	// The textures are never uploaded; the null backend doesn't look at them.
+	std::array<sf::Texture, n_atlases> textures;
+	std::mt19937 rng(3);
+	std::uniform_int_distribution<int> atlas(0, n_atlases - 1);
+	std::uniform_int_distribution<int> layer(0, n_layers - 1);
+	std::uniform_int_distribution<int> cell(0, 15);
+	std::uniform_real_distribution<float> coord(0.f, 1280.f);
+
+	// Sprites in a mixed order, as objects of different kinds would add them.
+	std::vector<Placed> placed;
+	for (std::size_t i = 0; i < n_sprites; ++i) {
+		const auto a = atlas(rng);
+		placed.push_back({
+			{ &textures[a], std::uint32_t(a), 
+				sf::IntRect(cell(rng) * 32, cell(rng) * 32, 32, 32) },
+			XYPair(XValue(coord(rng)), YValue(coord(rng))),
+			layer(rng)
+		});
+	}
+
+	os << n_sprites << " sprites from " << n_atlases << " atlases on " 
+		<< n_layers << " layers, " << n_frames << " frames" << std::endl;
+
+	// One sf::Sprite per sprite, grouped by layer so the result looks the 
+	// same as the batched one.
+	NullBackend per_sprite_backend;
+	RenderList list;
+	auto start = SteadyClock::now();
+
+	for (auto frame = 0; frame < n_frames; ++frame) {
+		list.clear();
+		for (auto l = 0; l < n_layers; ++l) {
+			for (const auto& p : placed) {
+				if (p.layer_ == l) {
+					sf::Sprite sprite(*p.region_.texture_, p.region_.rect_);
+					sprite.setPosition(float(p.pos_.x_), float(p.pos_.y_));
+					list.draw(sprite);
+				}
+			}
+		}
+		list.submit(per_sprite_backend);
+	}
+
+	const auto per_sprite = ms(SteadyClock::now() - start).count() / n_frames;
+
+	NullBackend batched_backend;
+	SpriteBatcher batcher;
+	start = SteadyClock::now();
+
+	for (auto frame = 0; frame < n_frames; ++frame) {
+		list.clear();
+		for (const auto& p : placed) {
+			batcher.add(p.region_, p.pos_, p.layer_);
+		}
+		batcher.flush(list);
+		list.submit(batched_backend);
+	}
+
+	const auto batched = ms(SteadyClock::now() - start).count() / n_frames;
+	const auto stats = batcher.stats();
+
+	os << "per sprite: " << per_sprite_backend.drawCount() / n_frames 
+		<< " draws/frame, " << per_sprite << " ms/frame" << std::endl
+		<< "batched: " << batched_backend.drawCount() / n_frames 
+		<< " draws/frame, " << batched << " ms/frame (" 
+		<< stats.sprites_ << " sprites in " << stats.batches_ << " batches)" 
+		<< std::endl;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "job/JobSystem.hpp"
+#include "object/GameObject.hpp"
+#include "object/Graphics.hpp"
+#include "object/Input.hpp"
+#include "object/Physics.hpp"
+#include "object/StagedUpdate.hpp"
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	constexpr std::size_t n_objects = 20'000;
+	constexpr auto n_steps = 50;
+
+	// Moves sideways while the player holds right.
+	class Nudge : public Input
+	{
+	public:
+		void
+		update(GameObject& obj, const KeyAction action)
+		override
+		{
+			if (action == KeyAction::Right) {
+				obj.setPosition(obj.getPosition() + XYPair(XValue(0.5f)));
+			}
+		}
+	};
+
+	// Drifts toward a few other objects, reading only their previous 
+	// positions as the staged update requires.
+	class Flock : public Physics
+	{
+	public:
+		Flock(const std::vector<GameObject*>& all, const std::size_t index)
+			: all_(all)
+			, index_(index)
+		{
+		}
+
+		void
+		update(GameObject& obj)
+		override
+		{
+			const auto n = all_.size();
+			const std::size_t neighbors[] = { 
+				(index_ + 1) % n, (index_ + n - 1) % n, index_ * 31 % n 
+			};
+
+			auto pos = obj.getPosition();
+			for (const auto other : neighbors) {
+				const auto target = all_[other]->getPreviousPosition();
+				const auto dx = float(target.x_) - float(pos.x_);
+				const auto dy = float(target.y_) - float(pos.y_);
+				const auto len = std::sqrt(dx * dx + dy * dy) + 1.f;
+				const auto wobble = std::sin(float(pos.y_) * 0.01f);
+				pos = pos + XYPair(
+					XValue(dx / len * 0.3f + wobble), 
+					YValue(dy / len * 0.3f)
+				);
+			}
+
+			obj.setPosition(pos);
+		}
+
+	private:
+		const std::vector<GameObject*>& all_;
+		std::size_t                     index_;
+	};
+
+	// Run the simulation from scratch, and get the final world checksum.
+	std::uint64_t
+	simulate(JobSystem& jobs, double& ms_per_step)
+	{
+		using ms = std::chrono::duration<double, std::milli>;
+
+		std::vector<std::unique_ptr<GameObject>> storage;
+		std::vector<GameObject*> objects;
+
+		for (std::size_t i = 0; i < n_objects; ++i) {
+			storage.push_back(std::make_unique<GameObject>(
+				XYPair(XValue(float(i % 200) * 5.f), YValue(float(i / 200) * 5.f)),
+				std::make_unique<Nudge>(),
+				std::make_unique<Flock>(objects, i),
+				nullptr
+			));
+			objects.push_back(storage.back().get());
+		}
+
+		const auto start = SteadyClock::now();
+		for (auto step = 0; step < n_steps; ++step) {
+			updateStaged(jobs, objects, 
+				step % 2 == 0 ? KeyAction::Right : KeyAction::Left);
+		}
+		ms_per_step = ms(SteadyClock::now() - start).count() / n_steps;
+
+		return checksum(objects);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+benchStagedUpdate(std::ostream& os)
+{
+	const auto cores = std::max(1u, std::thread::hardware_concurrency());
+
+	// Always include a few thread counts, even on machines with fewer cores, 
+	// so that determinism is checked everywhere.
+	std::set<std::size_t> thread_counts = { 1, 2, 4 };
+	for (std::size_t t = 1; t <= cores; t *= 2) {
+		thread_counts.insert(t);
+	}
+	thread_counts.insert(cores);
+
+	os << n_objects << " objects, " << n_steps << " steps, " 
+		<< cores << " cores" << std::endl;
+
+	auto reference = std::uint64_t(0);
+	auto single = 0.0;
+	auto mismatch = false;
+
+	for (const auto threads : thread_counts) {
+		JobSystem jobs(threads);
+		auto ms_per_step = 0.0;
+		const auto sum = simulate(jobs, ms_per_step);
+
+		if (threads == 1) {
+			reference = sum;
+			single = ms_per_step;
+		}
+
+		os << threads << " threads: " << ms_per_step << " ms/step, speedup " 
+			<< single / ms_per_step << "x, checksum " << std::hex << sum 
+			<< std::dec << std::endl;
+
+		mismatch = mismatch || sum != reference;
+	}
+
+	os << (mismatch ? "MISMATCH: results depend on thread count" 
+		: "checksums match") << std::endl;
+
+	return !mismatch;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
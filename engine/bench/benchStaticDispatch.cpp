@@ -0,0 +1,139 @@
+#include <memory>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "object/GameObject.hpp"
+#include "object/Graphics.hpp"
+#include "object/Input.hpp"
+#include "object/Physics.hpp"
+#include "object/StaticGameObject.hpp"
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	constexpr std::size_t n_objects = 100'000;
+	constexpr auto n_frames = 100;
+	constexpr auto dt = 1.f / 60.f;
+
+	// Constant-velocity movement, usable by both kinds of objects.
+	struct Drift
+	{
+		float vx_;
+		float vy_;
+
+		template <typename Object>
+		void
+		update(Object& obj)
+		noexcept
+		{
+			obj.setPosition(
+				obj.getPosition() + XYPair(XValue(vx_ * dt), YValue(vy_ * dt))
+			);
+		}
+	};
+
+	class DriftPhysics : public Physics
+	{
+	public:
+		explicit
+		DriftPhysics(const Drift& drift)
+			: drift_(drift)
+		{
+		}
+
+		void
+		update(GameObject& obj)
+		override
+		{
+			drift_.update(obj);
+		}
+
+	private:
+		Drift drift_;
+	};
+
+	using DriftObject = StaticGameObject<NoInput, Drift, NoGraphics>;
+
+	XYPair
+	startOf(const std::size_t i)
+	{
+		return { XValue(float(i % 1000)), YValue(float(i / 1000)) };
+	}
+
+	Drift
+	driftOf(const std::size_t i)
+	{
+		return { 1.f, float(i % 7) };
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+benchStaticDispatch(std::ostream& os)
+{
+	using ms = std::chrono::duration<double, std::milli>;
+
+	os << n_objects << " objects, " << n_frames << " frames" << std::endl;
+
+	std::vector<std::unique_ptr<GameObject>> dynamic;
+	dynamic.reserve(n_objects);
+	for (std::size_t i = 0; i < n_objects; ++i) {
+		dynamic.push_back(std::make_unique<GameObject>(
+			startOf(i), 
+			nullptr, 
+			std::make_unique<DriftPhysics>(driftOf(i)), 
+			nullptr
+		));
+	}
+
+	auto start = SteadyClock::now();
+	for (auto frame = 0; frame < n_frames; ++frame) {
+		for (auto& obj : dynamic) {
+			obj->update(KeyAction::count); // No Input, so unused.
+		}
+	}
+	const auto virtual_ms = ms(SteadyClock::now() - start).count() / n_frames;
+
+	std::vector<DriftObject> batch;
+	batch.reserve(n_objects);
+	for (std::size_t i = 0; i < n_objects; ++i) {
+		batch.emplace_back(startOf(i), NoInput(), driftOf(i));
+	}
+
+	start = SteadyClock::now();
+	for (auto frame = 0; frame < n_frames; ++frame) {
+		updateBatch(batch, KeyAction::count);
+	}
+	const auto static_ms = ms(SteadyClock::now() - start).count() / n_frames;
+
+	// Both paths must have moved the objects the same way.
+	auto mismatches = std::size_t(0);
+	for (std::size_t i = 0; i < n_objects; ++i) {
+		if (dynamic[i]->getPosition() != batch[i].getPosition()) {
+			++mismatches;
+		}
+	}
+
+	os << "GameObject (virtual): " << virtual_ms << " ms/frame" << std::endl
+		<< "StaticGameObject: " << static_ms << " ms/frame, "
+		<< "speedup " << virtual_ms / static_ms << "x" << std::endl;
+
+	if (mismatches != 0) {
+		os << "MISMATCH: " << mismatches << " objects differ" << std::endl;
+		return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
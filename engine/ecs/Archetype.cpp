@@ -0,0 +1,119 @@
+#include "Archetype.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+Archetype::Archetype(
+	const Signature signature, 
+	std::array<std::unique_ptr<Column>, max_components>&& columns)
+
+	: signature_(signature)
+	, columns_  (std::move(columns))
+{
+	for (ComponentId id = 0; id < max_components; ++id) {
+		BOOST_ASSERT(signature_.test(id) == (columns_[id] != nullptr));
+
+		if (signature_.test(id)) {
+			ids_.push_back(id);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+const Signature&
+Archetype::signature()
+const noexcept
+{
+	return signature_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+Archetype::size()
+const noexcept
+{
+	return entities_.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<Entity>&
+Archetype::entities()
+const noexcept
+{
+	return entities_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+Column&
+Archetype::column(const ComponentId id)
+noexcept
+{
+	BOOST_ASSERT(signature_.test(id));
+	return *columns_[id];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+Archetype::push(const Entity entity)
+{
+	entities_.push_back(entity);
+	return entities_.size() - 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::optional<Entity>
+Archetype::remove(const std::size_t row)
+{
+	BOOST_ASSERT(row < entities_.size());
+
+	for (const auto id : ids_) {
+		columns_[id]->swapRemove(row);
+	}
+
+	const auto last = entities_.size() - 1;
+	std::optional<Entity> moved;
+
+	if (row != last) {
+		entities_[row] = entities_[last];
+		moved = entities_[row];
+	}
+
+	entities_.pop_back();
+	return moved;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::array<std::unique_ptr<Column>, max_components>
+Archetype::cloneColumns()
+const
+{
+	std::array<std::unique_ptr<Column>, max_components> columns;
+
+	for (const auto id : ids_) {
+		columns[id] = columns_[id]->cloneEmpty();
+	}
+
+	return columns;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
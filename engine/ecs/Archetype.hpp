@@ -0,0 +1,201 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <boost/assert.hpp>
+
+#include "ecs/Component.hpp"
+#include "ecs/Entity.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Type-erased array of one component type.
+ ***/
+class Column
+{
+public:
+	virtual
+	~Column()
+	= default;
+
+	/***
+	 * @brief Create an empty column of the same component type.
+	 * 
+	 * @return Empty column.
+	 ***/
+	virtual std::unique_ptr<Column>
+	cloneEmpty()
+	const = 0;
+
+	/***
+	 * @brief Remove a row by moving the last row into it.
+	 * 
+	 * @param row         - Row to remove.
+	 ***/
+	virtual void
+	swapRemove(const std::size_t row)
+	= 0;
+
+	/***
+	 * @brief Move a row to the end of another column of the same type. The 
+	 * row is left in a moved-from state here.
+	 * 
+	 * @param row         - Row to move.
+	 * @param dst         - Column to append to.
+	 ***/
+	virtual void
+	moveRow(const std::size_t row, Column& dst)
+	= 0;
+};
+
+/***
+ * @brief Contiguous array of one component type.
+ ***/
+template <typename T>
+class ColumnOf final : public Column
+{
+public:
+	std::unique_ptr<Column>
+	cloneEmpty()
+	const override
+	{
+		return std::make_unique<ColumnOf<T>>();
+	}
+
+	void
+	swapRemove(const std::size_t row)
+	override
+	{
+		if (row + 1 != data_.size()) {
+			data_[row] = std::move(data_.back());
+		}
+		data_.pop_back();
+	}
+
+	void
+	moveRow(const std::size_t row, Column& dst)
+	override
+	{
+		static_cast<ColumnOf<T>&>(dst).data_.push_back(std::move(data_[row]));
+	}
+
+	std::vector<T> data_; ///< Components, one per row.
+};
+
+/***
+ * @brief Storage for all entities that have exactly the same set of component 
+ * types.
+ * 
+ * Each component type is stored in its own contiguous array, and row i of 
+ * every array belongs to the same entity. Systems can therefore walk the 
+ * arrays they need front to back without chasing pointers.
+ ***/
+class Archetype
+{
+public:
+	/***
+	 * @brief Construct an archetype without entities.
+	 * 
+	 * @param signature   - Component types of the archetype.
+	 * @param columns     - An empty column for each component type, indexed 
+	 *                      by component ID.
+	 ***/
+	Archetype(
+		const Signature signature, 
+		std::array<std::unique_ptr<Column>, max_components>&& columns);
+
+	/***
+	 * @brief Get the archetype's component types.
+	 * 
+	 * @return Signature.
+	 ***/
+	const Signature&
+	signature()
+	const noexcept;
+
+	/***
+	 * @brief Get the number of entities.
+	 * 
+	 * @return Entity count.
+	 ***/
+	std::size_t
+	size()
+	const noexcept;
+
+	/***
+	 * @brief Get the entities, in row order.
+	 * 
+	 * @return Entities.
+	 ***/
+	const std::vector<Entity>&
+	entities()
+	const noexcept;
+
+	/***
+	 * @brief Get the type-erased column of a component type.
+	 * 
+	 * @param id          - Component ID. Must be part of the signature.
+	 * 
+	 * @return Column.
+	 ***/
+	Column&
+	column(const ComponentId id)
+	noexcept;
+
+	/***
+	 * @brief Get the array of a component type.
+	 * 
+	 * @return Components in row order.
+	 ***/
+	template <typename T>
+	std::vector<T>&
+	components()
+	noexcept
+	{
+		return static_cast<ColumnOf<T>&>(column(componentId<T>())).data_;
+	}
+
+	/***
+	 * @brief Register an entity whose components have just been appended to 
+	 * every column.
+	 * 
+	 * @param entity      - New entity.
+	 * 
+	 * @return Row of the entity.
+	 ***/
+	std::size_t
+	push(const Entity entity);
+
+	/***
+	 * @brief Remove a row from every column.
+	 * 
+	 * @param row         - Row to remove.
+	 * 
+	 * @return The entity that was moved into the row to fill the gap, if any.
+	 ***/
+	std::optional<Entity>
+	remove(const std::size_t row);
+
+	/***
+	 * @brief Get an empty copy of every column.
+	 * 
+	 * @return Empty columns, indexed by component ID.
+	 ***/
+	std::array<std::unique_ptr<Column>, max_components>
+	cloneColumns()
+	const;
+
+private:
+	Signature signature_; ///< Component types.
+	std::array<std::unique_ptr<Column>, max_components> columns_; ///< Columns 
+	// indexed by component ID, null for types not in the signature.
+	std::vector<ComponentId> ids_; ///< Component types, for quick iteration.
+	std::vector<Entity> entities_; ///< Entity of each row.
+};
+
+}
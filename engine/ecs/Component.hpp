@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <bitset>
+#include <cstddef>
+#include <boost/assert.hpp>
+
+namespace nemo
+{
+
+///< Maximum number of distinct component types.
+constexpr std::size_t max_components = 64;
+
+///< Numeric ID of a component type.
+using ComponentId = std::size_t;
+
+///< Set of component types an entity has.
+using Signature = std::bitset<max_components>;
+
+namespace detail
+{
+	inline ComponentId
+	nextComponentId()
+	noexcept
+	{
+		// Types can be first asked for from several job threads at once.
+		static std::atomic<ComponentId> next = 0;
+		return next.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+/***
+ * @brief Get the ID of a component type. IDs are handed out the first time a 
+ * type is asked for.
+ * 
+ * @return Component ID.
+ ***/
+template <typename T>
+ComponentId
+componentId()
+noexcept
+{
+	static const auto id = detail::nextComponentId();
+	BOOST_ASSERT(id < max_components);
+	return id;
+}
+
+/***
+ * @brief Get the signature of a set of component types.
+ * 
+ * @return Signature with the bit of each type set.
+ ***/
+template <typename... Cs>
+Signature
+signatureOf()
+noexcept
+{
+	Signature signature;
+	(signature.set(componentId<Cs>()), ...);
+	return signature;
+}
+
+}
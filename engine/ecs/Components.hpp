@@ -0,0 +1,24 @@
+#pragma once
+
+namespace nemo
+{
+
+/***
+ * @brief Position of an entity in the world.
+ ***/
+struct Position
+{
+	float x_;
+	float y_;
+};
+
+/***
+ * @brief Movement of an entity per second.
+ ***/
+struct Velocity
+{
+	float x_;
+	float y_;
+};
+
+}
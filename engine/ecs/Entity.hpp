@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+
+namespace nemo
+{
+
+/***
+ * @brief Handle to an entity in a @class World.
+ * 
+ * The index is reused once the entity is destroyed, but the generation is 
+ * bumped, so handles to a destroyed entity never refer to a new one.
+ ***/
+struct Entity
+{
+	std::uint32_t index_;      ///< Slot in the world's entity records.
+	std::uint32_t generation_; ///< Times the slot has been reused.
+
+	bool
+	operator== (const Entity& rhs)
+	const noexcept
+	{
+		return index_ == rhs.index_ && generation_ == rhs.generation_;
+	}
+
+	bool
+	operator!= (const Entity& rhs)
+	const noexcept
+	{
+		return !(*this == rhs);
+	}
+};
+
+}
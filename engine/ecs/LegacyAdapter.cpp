@@ -0,0 +1,64 @@
+#include "LegacyAdapter.hpp"
+#include "ecs/Components.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	XYPair
+	toXY(const Position& pos)
+	{
+		return { XValue(pos.x_), YValue(pos.y_) };
+	}
+
+	Position
+	fromXY(const XYPair& xy)
+	{
+		return { float(xy.x_), float(xy.y_) };
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+updateLegacy(World& world, const KeyAction action)
+{
+	// Objects whose position has already moved to the Position component.
+	world.each<GameObject, Position>(
+		[action](GameObject& obj, Position& pos) {
+			obj.setPosition(toXY(pos));
+			obj.update(action);
+			pos = fromXY(obj.getPosition());
+		}
+	);
+
+	// Objects that haven't.
+	world.each<GameObject>(
+		[action](GameObject& obj) {
+			obj.update(action);
+		},
+		signatureOf<Position>()
+	);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+drawLegacy(World& world, RenderList& list, const float alpha)
+{
+	world.each<GameObject>(
+		[&list, alpha](GameObject& obj) {
+			obj.draw(list, alpha);
+		}
+	);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "ecs/World.hpp"
+#include "object/GameObject.hpp"
+#include "render/RenderList.hpp"
+#include "utility/type/Key.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Systems that run GameObjects stored as components, so that objects 
+ * built from the existing Input, Physics, and Graphics classes can live in a 
+ * @class World while their behavior is moved to plain components one piece at 
+ * a time.
+ * 
+ * An entity can have both a GameObject and a @struct Position. While it does, 
+ * the Position component is the one other systems read and write, and it is 
+ * copied into the GameObject before its components run and back out after. 
+ * Once an object's Physics has been replaced by e.g. a @struct Velocity, its 
+ * GameObject can be created without one; once all three are replaced, the 
+ * GameObject component can be removed.
+ ***/
+
+/***
+ * @brief Run the Input and Physics of every GameObject component.
+ * 
+ * @param world       - Entities.
+ * @param action      - Player input.
+ ***/
+void
+updateLegacy(World& world, const KeyAction action);
+
+/***
+ * @brief Run the Graphics of every GameObject component.
+ * 
+ * @param world       - Entities.
+ * @param list        - Render list for the current frame.
+ * @param alpha       - Interpolation factor of the frame.
+ ***/
+void
+drawLegacy(World& world, RenderList& list, const float alpha);
+
+}
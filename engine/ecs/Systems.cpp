@@ -0,0 +1,26 @@
+#include "Systems.hpp"
+#include "ecs/Components.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+integrate(World& world, const float dt)
+{
+	world.eachArray<Position, Velocity>(
+		[dt](const std::size_t n, Position* pos, Velocity* vel) {
+			for (std::size_t i = 0; i < n; ++i) {
+				pos[i].x_ += vel[i].x_ * dt;
+				pos[i].y_ += vel[i].y_ * dt;
+			}
+		}
+	);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "ecs/World.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Move every entity that has a position and a velocity.
+ * 
+ * @param world       - Entities.
+ * @param dt          - Seconds to move them by.
+ ***/
+void
+integrate(World& world, const float dt);
+
+}
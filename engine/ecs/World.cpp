@@ -0,0 +1,125 @@
+#include "World.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+World::destroy(const Entity entity)
+{
+	BOOST_ASSERT(alive(entity));
+	auto& record = records_[entity.index_];
+
+	vacate(record);
+
+	// Bumping the generation makes every handle to the entity stale.
+	record.archetype_ = nullptr;
+	++record.generation_;
+	free_.push_back(entity.index_);
+	--size_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+World::alive(const Entity entity)
+const noexcept
+{
+	return entity.index_ < records_.size()
+		&& records_[entity.index_].archetype_ != nullptr
+		&& records_[entity.index_].generation_ == entity.generation_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+World::size()
+const noexcept
+{
+	return size_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+Archetype*
+World::findArchetype(const Signature signature)
+const
+{
+	const auto it = archetypes_.find(signature);
+	return it != archetypes_.cend() ? it->second.get() : nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+Archetype&
+World::makeArchetype(
+	const Signature signature, 
+	std::array<std::unique_ptr<Column>, max_components>&& columns)
+{
+	auto& arch = archetypes_[signature];
+	BOOST_ASSERT(arch == nullptr);
+
+	arch = std::make_unique<Archetype>(signature, std::move(columns));
+	order_.push_back(arch.get());
+	return *arch;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+Entity
+World::allocate()
+{
+	if (free_.empty()) {
+		records_.push_back({ nullptr, 0, 0 });
+		return { static_cast<std::uint32_t>(records_.size() - 1), 0 };
+	}
+
+	const auto index = free_.back();
+	free_.pop_back();
+	return { index, records_[index].generation_ };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+World::migrate(const Entity entity, Archetype& to)
+{
+	auto& record = records_[entity.index_];
+	auto& from = *record.archetype_;
+
+	// Carry over the components both archetypes have.
+	for (ComponentId id = 0; id < max_components; ++id) {
+		if (from.signature().test(id) && to.signature().test(id)) {
+			from.column(id).moveRow(record.row_, to.column(id));
+		}
+	}
+
+	vacate(record);
+	record.archetype_ = &to;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+World::vacate(const Record& record)
+{
+	const auto row = record.row_;
+
+	if (const auto moved = record.archetype_->remove(row); moved) {
+		records_[moved->index_].row_ = row;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,347 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <boost/assert.hpp>
+
+#include "ecs/Archetype.hpp"
+#include "ecs/Component.hpp"
+#include "ecs/Entity.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Archetype-based entity-component store.
+ * 
+ * Entities are grouped by the exact set of component types they have, and 
+ * each group keeps its components in per-type contiguous arrays (see 
+ * @class Archetype). Systems ask for the entities that have a given set of 
+ * component types with @property each or @property eachArray, and get to 
+ * iterate over tight arrays instead of chasing one heap object per entity.
+ * 
+ * Entities must not be created, destroyed, or have components added or 
+ * removed while an iteration is running.
+ ***/
+class World
+{
+public:
+	/***
+	 * @brief Create an entity.
+	 * 
+	 * @param values      - Initial components, at most one of each type.
+	 * 
+	 * @return Handle to the new entity.
+	 ***/
+	template <typename... Cs>
+	Entity
+	create(Cs... values);
+
+	/***
+	 * @brief Destroy an entity and its components. Handles to it become 
+	 * stale.
+	 * 
+	 * This method generates an assertion error if the entity is already dead.
+	 * 
+	 * @param entity      - Entity to destroy.
+	 ***/
+	void
+	destroy(const Entity entity);
+
+	/***
+	 * @brief Indicates whether a handle still refers to a live entity.
+	 * 
+	 * @param entity      - Handle to check.
+	 * 
+	 * @return True if yes, false otherwise.
+	 ***/
+	bool
+	alive(const Entity entity)
+	const noexcept;
+
+	/***
+	 * @brief Get one of an entity's components.
+	 * 
+	 * The pointer is invalidated by any change to the set of entities or to 
+	 * their component types.
+	 * 
+	 * @param entity      - Live entity.
+	 * 
+	 * @return The component, or nullptr if the entity doesn't have one.
+	 ***/
+	template <typename T>
+	T*
+	get(const Entity entity);
+
+	/***
+	 * @brief Give an entity a component it doesn't have yet. The entity moves 
+	 * to the archetype with the extra type.
+	 * 
+	 * @param entity      - Live entity.
+	 * @param component   - Component to add.
+	 ***/
+	template <typename T>
+	void
+	add(const Entity entity, T component);
+
+	/***
+	 * @brief Take a component away from an entity. The entity moves to the 
+	 * archetype without that type.
+	 * 
+	 * @param entity      - Live entity that has the component.
+	 ***/
+	template <typename T>
+	void
+	remove(const Entity entity);
+
+	/***
+	 * @brief Call a function for every entity that has all of the given 
+	 * component types.
+	 * 
+	 * @param fn          - Callable taking a reference to each component.
+	 * @param excluded    - Component types the entities must not have.
+	 ***/
+	template <typename... Cs, typename Fn>
+	void
+	each(Fn&& fn, const Signature excluded = Signature());
+
+	/***
+	 * @brief Call a function once per archetype that has all of the given 
+	 * component types, with the raw arrays of those types.
+	 * 
+	 * This is the form to use for loops that should vectorize.
+	 * 
+	 * @param fn          - Callable taking the number of entities followed by 
+	 *                      a pointer to the first element of each array.
+	 * @param excluded    - Component types the entities must not have.
+	 ***/
+	template <typename... Cs, typename Fn>
+	void
+	eachArray(Fn&& fn, const Signature excluded = Signature());
+
+	/***
+	 * @brief Get the number of live entities.
+	 * 
+	 * @return Entity count.
+	 ***/
+	std::size_t
+	size()
+	const noexcept;
+
+private:
+	/***
+	 * @brief Where an entity's components are stored.
+	 ***/
+	struct Record
+	{
+		Archetype*    archetype_;  ///< Archetype, or nullptr if the slot is free.
+		std::size_t   row_;        ///< Row in the archetype.
+		std::uint32_t generation_; ///< Current generation of the slot.
+	};
+
+	/***
+	 * @brief Get the archetype for a signature.
+	 * 
+	 * @param signature   - Component types.
+	 * 
+	 * @return Archetype, or nullptr if there is none yet.
+	 ***/
+	Archetype*
+	findArchetype(const Signature signature)
+	const;
+
+	/***
+	 * @brief Create the archetype for a signature, which must not exist yet.
+	 * 
+	 * Callers look the archetype up first, so that the columns are only built 
+	 * when it is new.
+	 * 
+	 * @param signature   - Component types.
+	 * @param columns     - Empty columns to create the archetype with.
+	 * 
+	 * @return Archetype.
+	 ***/
+	Archetype&
+	makeArchetype(
+		const Signature signature, 
+		std::array<std::unique_ptr<Column>, max_components>&& columns);
+
+	/***
+	 * @brief Take a free entity slot.
+	 * 
+	 * @return New entity handle.
+	 ***/
+	Entity
+	allocate();
+
+	/***
+	 * @brief Move an entity's components to another archetype. Components of 
+	 * types the other archetype doesn't have are dropped. The caller must 
+	 * append the components of types only the other archetype has, and then 
+	 * call @property Archetype::push.
+	 * 
+	 * @param entity      - Live entity.
+	 * @param to          - Destination archetype.
+	 ***/
+	void
+	migrate(const Entity entity, Archetype& to);
+
+	/***
+	 * @brief Remove an entity's row from its archetype and fix up the record 
+	 * of the entity that fills the gap.
+	 * 
+	 * @param record      - Record of the entity to remove.
+	 ***/
+	void
+	vacate(const Record& record);
+
+	/***
+	 * @brief Private attributes.
+	 ***/
+	std::unordered_map<Signature, std::unique_ptr<Archetype>> archetypes_; 
+	///< Archetypes by signature.
+	std::vector<Archetype*>    order_;   ///< Archetypes in creation order.
+	std::vector<Record>        records_; ///< Entity slots.
+	std::vector<std::uint32_t> free_;    ///< Free entity slots.
+	std::size_t                size_ = 0; ///< Live entities.
+};
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename... Cs>
+Entity
+World::create(Cs... values)
+{
+	const auto signature = signatureOf<Cs...>();
+	BOOST_ASSERT(signature.count() == sizeof...(Cs));
+
+	Archetype* to = findArchetype(signature);
+	if (to == nullptr) {
+		std::array<std::unique_ptr<Column>, max_components> columns;
+		((columns[componentId<Cs>()] = std::make_unique<ColumnOf<Cs>>()), ...);
+		to = &makeArchetype(signature, std::move(columns));
+	}
+
+	const auto entity = allocate();
+	(to->components<Cs>().push_back(std::move(values)), ...);
+	records_[entity.index_].archetype_ = to;
+	records_[entity.index_].row_ = to->push(entity);
+	++size_;
+	return entity;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+T*
+World::get(const Entity entity)
+{
+	BOOST_ASSERT(alive(entity));
+	const auto& record = records_[entity.index_];
+
+	if (!record.archetype_->signature().test(componentId<T>())) {
+		return nullptr;
+	}
+
+	return &record.archetype_->components<T>()[record.row_];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+void
+World::add(const Entity entity, T component)
+{
+	BOOST_ASSERT(alive(entity));
+	Archetype& from = *records_[entity.index_].archetype_;
+	const auto id = componentId<T>();
+	BOOST_ASSERT(!from.signature().test(id));
+
+	auto signature = from.signature();
+	signature.set(id);
+
+	Archetype* to = findArchetype(signature);
+	if (to == nullptr) {
+		auto columns = from.cloneColumns();
+		columns[id] = std::make_unique<ColumnOf<T>>();
+		to = &makeArchetype(signature, std::move(columns));
+	}
+
+	migrate(entity, *to);
+	to->components<T>().push_back(std::move(component));
+	records_[entity.index_].row_ = to->push(entity);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+void
+World::remove(const Entity entity)
+{
+	BOOST_ASSERT(alive(entity));
+	Archetype& from = *records_[entity.index_].archetype_;
+	const auto id = componentId<T>();
+	BOOST_ASSERT(from.signature().test(id));
+
+	auto signature = from.signature();
+	signature.reset(id);
+
+	Archetype* to = findArchetype(signature);
+	if (to == nullptr) {
+		auto columns = from.cloneColumns();
+		columns[id] = nullptr;
+		to = &makeArchetype(signature, std::move(columns));
+	}
+
+	migrate(entity, *to);
+	records_[entity.index_].row_ = to->push(entity);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename... Cs, typename Fn>
+void
+World::each(Fn&& fn, const Signature excluded)
+{
+	eachArray<Cs...>(
+		[&fn](const std::size_t n, Cs*... arrays) {
+			for (std::size_t i = 0; i < n; ++i) {
+				fn(arrays[i]...);
+			}
+		},
+		excluded
+	);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename... Cs, typename Fn>
+void
+World::eachArray(Fn&& fn, const Signature excluded)
+{
+	const auto required = signatureOf<Cs...>();
+
+	for (auto arch : order_) {
+		const auto signature = arch->signature();
+
+		if ((signature & required) != required || (signature & excluded).any() 
+			|| arch->size() == 0) {
+			continue;
+		}
+
+		fn(arch->size(), arch->components<Cs>().data()...);
+	}
+}
+
+}
@@ -0,0 +1,265 @@
+#include <boost/assert.hpp>
+
+#include "Inventory.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+Inventory::Inventory(const std::size_t capacity)
+	: capacity_(capacity)
+	, weight_  (0)
+{
+	BOOST_ASSERT(capacity_ > 0);
+
+	// In the worst case, every item in the inventory is unique, i.e. there 
+	// are no extra copies of any item.
+	storage_.reserve(capacity_);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+Inventory::add(std::shared_ptr<Item> item)
+{
+	if (weight_ == capacity_) {
+		return false;
+	}
+
+	++weight_;
+
+	// Add the item to the storage, and move it to the front of the recency 
+	// list, whether it already existed in the inventory or not.
+	const auto id = item->id();
+	const auto [it, added] = storage_.try_emplace(id, id);
+	auto& entry = it->second;
+	const auto in_front = !added && &order_.front() == &entry;
+
+	// The indexes read the name and category from any copy, so every copy 
+	// must agree on them.
+	BOOST_ASSERT(added || (entry.any().name() == item->name()
+		&& entry.any().category() == item->category()));
+
+	if (item->unique()) {
+		entry.uniques_.push_back(std::move(item));
+	}
+	else {
+		// Any copy can stand for the others, so only the first one is kept.
+		if (entry.count_++ == 0) {
+			entry.prototype_ = std::move(item);
+		}
+	}
+
+	touch(entry);
+
+	if (added) {
+		index(entry);
+		notify(InventoryChange::Type::Added, id, entry.size());
+	}
+	else {
+		if (!in_front) {
+			notify(InventoryChange::Type::MovedToFront, id, entry.size() - 1);
+		}
+		notify(InventoryChange::Type::CountChanged, id, entry.size());
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::optional<std::pair<std::shared_ptr<Item>, std::size_t>>
+Inventory::remove(const int id, const std::size_t which)
+{
+	// Its place in the recency list comes with the entry.
+	const auto it = storage_.find(id);
+	BOOST_ASSERT(it != storage_.cend());
+
+	auto& entry = it->second;
+	BOOST_ASSERT(which < entry.size());
+
+	if (entry.size() == 1) {
+		// This is the last one. Unlink the item while a copy is left to tell 
+		// where it is in the indexes.
+		unlink(entry);
+	}
+
+	// Remove the selected copy, from the stack or from the unique ones.
+	std::shared_ptr<Item> item;
+	if (which < entry.count_) {
+		// The copies left keep the prototype, so the caller gets its own, 
+		// unless this was the last one.
+		item = --entry.count_ == 0 
+			? std::move(entry.prototype_) 
+			: entry.prototype_->clone();
+	}
+	else {
+		const auto unique = entry.uniques_.cbegin() + (which - entry.count_);
+		item = *unique;
+		entry.uniques_.erase(unique);
+	}
+
+	const auto n_remain = entry.size();
+
+	--weight_;
+
+	if (n_remain == 0) {
+		storage_.erase(it);
+		notify(InventoryChange::Type::Removed, id, 0);
+	}
+	else {
+		notify(InventoryChange::Type::CountChanged, id, n_remain);
+	}
+
+	return { { item, n_remain } };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+Inventory::remove(const int id)
+{
+	const auto it = storage_.find(id);
+	BOOST_ASSERT(it != storage_.cend());
+
+	weight_ -= it->second.size();
+	unlink(it->second);
+	storage_.erase(it);
+	notify(InventoryChange::Type::Removed, id, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+Inventory::View
+Inventory::view()
+const noexcept
+{
+	using It = View::const_iterator;
+	return { It(order_.cbegin()), It(order_.cend()), storage_.size() };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+Inventory::NameView
+Inventory::viewByName()
+const noexcept
+{
+	using It = NameView::const_iterator;
+	return { It(by_name_.cbegin()), It(by_name_.cend()), storage_.size() };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+Inventory::CategoryView
+Inventory::viewByCategory()
+const noexcept
+{
+	using It = CategoryView::const_iterator;
+	return { It(by_category_.cbegin()), It(by_category_.cend()), 
+		storage_.size() };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+Inventory::CategoryView
+Inventory::viewByCategory(const ItemCategory category)
+const noexcept
+{
+	using It = CategoryView::const_iterator;
+	const auto [first, last] = by_category_.equal_range(category, 
+		CategoryLess());
+	return { It(first), It(last), category_sizes_[std::size_t(category)] };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+Inventory::subscribe(InventoryListener& listener)
+{
+	BOOST_ASSERT(std::find(listeners_.cbegin(), listeners_.cend(), &listener)
+		== listeners_.cend());
+
+	listeners_.push_back(&listener);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+Inventory::unsubscribe(InventoryListener& listener)
+{
+	const auto it = std::find(listeners_.cbegin(), listeners_.cend(), 
+		&listener);
+	BOOST_ASSERT(it != listeners_.cend());
+
+	listeners_.erase(it);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+Inventory::touch(Entry& entry)
+noexcept
+{
+	if (entry.hook_.is_linked()) {
+		order_.erase(order_.iterator_to(entry));
+	}
+
+	order_.push_front(entry);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+Inventory::index(Entry& entry)
+{
+	by_name_.insert(entry);
+	by_category_.insert(entry);
+	++category_sizes_[std::size_t(entry.any().category())];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+Inventory::unlink(Entry& entry)
+noexcept
+{
+	--category_sizes_[std::size_t(entry.any().category())];
+	by_category_.erase(by_category_.iterator_to(entry));
+	by_name_.erase(by_name_.iterator_to(entry));
+	order_.erase(order_.iterator_to(entry));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+Inventory::notify(
+	const InventoryChange::Type type, 
+	const int id, 
+	const std::size_t count)
+const
+{
+	const InventoryChange change{ type, id, count };
+	for (const auto listener : listeners_) {
+		listener->inventoryChanged(change);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
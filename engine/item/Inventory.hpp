@@ -0,0 +1,523 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <boost/intrusive/list.hpp>
+#include <boost/intrusive/set.hpp>
+
+#include "item/InventoryListener.hpp"
+#include "item/Item.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Player's inventory of items.
+ * 
+ * Any item the player finds or buys is added here, and any item the player 
+ * discards or sells is removed from here. Both unequipped and equipped items 
+ * are listed, so items are stored as shared pointers. Any changes to a unique 
+ * item's info, such as any upgrades, will be reflected in the inventory.
+ * 
+ * Copies of an item that aren't unique are interchangeable, so they are kept 
+ * as a stack: one of them and a count. 99 potions take as much memory as one. 
+ * Unique copies, such as upgraded weapons, are kept individually. Since every 
+ * stacked copy is the same object, changing one would change them all, so an 
+ * item that is meant to change must be constructed unique.
+ * 
+ * The contents are read through @property view, which copies nothing, and 
+ * anything that shows them can subscribe to be told what changed instead of 
+ * reading them all again. They can also be read sorted by name, or grouped by 
+ * category, through indexes kept up to date as items come and go, so nothing 
+ * is sorted when the inventory is shown.
+ ***/
+class Inventory
+{
+private:
+	/***
+	 * @brief All copies of one item, linked into the recency list and the 
+	 * indexes.
+	 * 
+	 * Entries live in the storage map, which never moves them, so the list 
+	 * and indexes can link them directly and no search is needed to move or 
+	 * unlink one.
+	 ***/
+	struct Entry
+	{
+		int                                id_;        ///< Item's ID.
+		std::shared_ptr<Item>              prototype_; ///< Stands for stack.
+		std::size_t                        count_ = 0; ///< Stacked copies.
+		std::vector<std::shared_ptr<Item>> uniques_;   ///< Unique copies.
+		boost::intrusive::list_member_hook<> hook_;          ///< Place in list.
+		boost::intrusive::set_member_hook<>  name_hook_;     ///< By name.
+		boost::intrusive::set_member_hook<>  category_hook_; ///< By category.
+
+		explicit
+		Entry(const int id)
+			: id_(id)
+		{
+		}
+
+		std::size_t
+		size()
+		const noexcept
+		{
+			return count_ + uniques_.size();
+		}
+
+		/***
+		 * @brief Get any copy, to read what all copies share.
+		 * 
+		 * @return The stacked copy if there is one, else the first unique one.
+		 ***/
+		const Item&
+		any()
+		const noexcept
+		{
+			return count_ > 0 ? *prototype_ : *uniques_[0];
+		}
+	};
+
+	/***
+	 * @brief Orders entries by name. The ID breaks ties between items that 
+	 * share a name.
+	 ***/
+	struct NameLess
+	{
+		bool
+		operator()(const Entry& a, const Entry& b)
+		const noexcept
+		{
+			return std::forward_as_tuple(a.any().name(), a.id_)
+				< std::forward_as_tuple(b.any().name(), b.id_);
+		}
+	};
+
+	/***
+	 * @brief Orders entries by category, then the same as @struct NameLess. 
+	 * An entry can also be compared to a category alone, to find where the 
+	 * category starts and ends.
+	 ***/
+	struct CategoryLess
+	{
+		bool
+		operator()(const Entry& a, const Entry& b)
+		const noexcept
+		{
+			const auto a_cat = a.any().category();
+			const auto b_cat = b.any().category();
+			return a_cat != b_cat ? a_cat < b_cat : NameLess()(a, b);
+		}
+
+		bool
+		operator()(const Entry& a, const ItemCategory b)
+		const noexcept
+		{
+			return a.any().category() < b;
+		}
+
+		bool
+		operator()(const ItemCategory a, const Entry& b)
+		const noexcept
+		{
+			return a < b.any().category();
+		}
+	};
+
+	using RecencyList = boost::intrusive::list<
+		Entry, 
+		boost::intrusive::member_hook<
+			Entry, boost::intrusive::list_member_hook<>, &Entry::hook_
+		>, 
+		boost::intrusive::constant_time_size<false>
+	>;
+
+	using NameIndex = boost::intrusive::set<
+		Entry, 
+		boost::intrusive::member_hook<
+			Entry, boost::intrusive::set_member_hook<>, &Entry::name_hook_
+		>, 
+		boost::intrusive::compare<NameLess>, 
+		boost::intrusive::constant_time_size<false>
+	>;
+
+	using CategoryIndex = boost::intrusive::set<
+		Entry, 
+		boost::intrusive::member_hook<
+			Entry, boost::intrusive::set_member_hook<>, &Entry::category_hook_
+		>, 
+		boost::intrusive::compare<CategoryLess>, 
+		boost::intrusive::constant_time_size<false>
+	>;
+
+public:
+	/***
+	 * @brief What the player sees of one item in the inventory.
+	 * 
+	 * The name is a view of the item's own, valid until the item is removed.
+	 ***/
+	struct Slot
+	{
+		int              id_;    ///< Item's ID.
+		std::string_view name_;  ///< Item's name.
+		std::size_t      count_; ///< Quantity.
+	};
+
+	template <typename Base> class Iterator;
+	template <typename Base> class Range;
+
+	///< Items from most recently found to least recently.
+	using View = Range<RecencyList::const_iterator>;
+
+	///< Items in alphabetical order.
+	using NameView = Range<NameIndex::const_iterator>;
+
+	///< Items grouped by category, each group in alphabetical order.
+	using CategoryView = Range<CategoryIndex::const_iterator>;
+
+	/***
+	 * @brief Construct an empty inventory.
+	 * 
+	 * @param capacity    - Maximum number of items the inventory can hold. 
+	 *                      Generates an assertion error if 0.
+	 ***/
+	explicit
+	Inventory(const std::size_t capacity);
+
+	Inventory(const Inventory&) = delete;
+	Inventory& operator=(const Inventory&) = delete;
+
+	/***
+	 * @brief Add an item to the inventory. Multiple copies of the same item 
+	 * each count toward the capacity.
+	 * 
+	 * @param item        - Item to add.
+	 * 
+	 * @return True if the item has been added, false if the inventory is full.
+	 ***/
+	bool
+	add(std::shared_ptr<Item> item);
+
+	/***
+	 * @brief Remove one copy of an item from the inventory.
+	 * 
+	 * Generates an assertion error if the item cannot be found via @p id, or 
+	 * if @p which is out of range.
+	 * 
+	 * @param id          - ID of the item of which one copy is to be removed.
+	 * @param which       - 0-based index of the copy to remove. The stacked 
+	 *                      copies come first, then the unique ones in the 
+	 *                      order they were added. 0 if there is only one.
+	 * 
+	 * @return The removed item and how many of them are left in the inventory 
+	 * after the removal, or nullopt if the item cannot be removed. For a 
+	 * stacked copy, the item is a copy of the one kept for the stack, so 
+	 * changing it leaves the copies still in the inventory alone.
+	 ***/
+	[[nodiscard]]
+	std::optional<std::pair<std::shared_ptr<Item>, std::size_t>>
+	remove(const int id, const std::size_t which);
+
+	/***
+	 * @brief Remove all copies of an item from the inventory. Generates an 
+	 * assertion error if the item cannot be found via @p id.
+	 * 
+	 * @param id          - ID of the item to remove all of.
+	 ***/
+	void
+	remove(const int id);
+
+	/***
+	 * @brief View the items currently in the inventory, from most recently 
+	 * found to least recently.
+	 * 
+	 * Nothing is copied or allocated. The view is invalidated by any change 
+	 * to the inventory.
+	 * 
+	 * @return The view over all items.
+	 ***/
+	View
+	view()
+	const noexcept;
+
+	/***
+	 * @brief View the items currently in the inventory in alphabetical order. 
+	 * Like @property view, nothing is copied, allocated or sorted.
+	 * 
+	 * @return The view over all items.
+	 ***/
+	NameView
+	viewByName()
+	const noexcept;
+
+	/***
+	 * @brief View the items currently in the inventory grouped by category. 
+	 * Like @property view, nothing is copied, allocated or sorted.
+	 * 
+	 * @return The view over all items.
+	 ***/
+	CategoryView
+	viewByCategory()
+	const noexcept;
+
+	/***
+	 * @brief View the items of one category in alphabetical order. Finding 
+	 * where the category starts and ends takes logarithmic time.
+	 * 
+	 * @param category    - Category to keep.
+	 * 
+	 * @return The view over the items of @p category.
+	 ***/
+	CategoryView
+	viewByCategory(const ItemCategory category)
+	const noexcept;
+
+	/***
+	 * @brief Start telling a listener about every change to the inventory. 
+	 * The listener must unsubscribe before it is destroyed.
+	 * 
+	 * @param listener    - Listener to tell.
+	 ***/
+	void
+	subscribe(InventoryListener& listener);
+
+	/***
+	 * @brief Stop telling a listener about changes to the inventory.
+	 * 
+	 * @param listener    - Listener subscribed earlier.
+	 ***/
+	void
+	unsubscribe(InventoryListener& listener);
+
+private:
+	/***
+	 * @brief Move an item to the front of the recency list, linking it if it 
+	 * isn't yet.
+	 * 
+	 * @param entry       - All copies of the item.
+	 ***/
+	void
+	touch(Entry& entry)
+	noexcept;
+
+	/***
+	 * @brief Link a new item into the indexes.
+	 * 
+	 * @param entry       - All copies of the item, at least one.
+	 ***/
+	void
+	index(Entry& entry);
+
+	/***
+	 * @brief Unlink an item from the recency list and the indexes, before 
+	 * removing it from the storage.
+	 * 
+	 * @param entry       - All copies of the item, at least one.
+	 ***/
+	void
+	unlink(Entry& entry)
+	noexcept;
+
+	/***
+	 * @brief Tell every listener about a change.
+	 * 
+	 * @param type        - What kind of change it is.
+	 * @param id          - ID of the changed item.
+	 * @param count       - Quantity of the item after the change.
+	 ***/
+	void
+	notify(
+		const InventoryChange::Type type, 
+		const int id, 
+		const std::size_t count)
+	const;
+
+	const std::size_t capacity_; ///< Maximum number of items.
+	std::size_t       weight_;   ///< Current number of items.
+
+	std::unordered_map<int, Entry> storage_; ///< All copies of each item, by
+	// ID. Unordered for speed; the order is kept by the list and indexes.
+
+	RecencyList order_; ///< The same entries, from most recently found to
+	// least recently, which is the order of @property view and where players 
+	// expect an item they just found to be. Moving an entry to the front or 
+	// unlinking it takes constant time. Must be declared after the storage, 
+	// so that it is emptied before the entries are destroyed.
+
+	NameIndex     by_name_;     ///< The same entries, sorted by name.
+	CategoryIndex by_category_; ///< The same entries, sorted by category.
+	// Both are red-black trees, so linking or unlinking an entry takes 
+	// logarithmic time. Like the list, they must follow the storage.
+
+	std::array<std::size_t, std::size_t(ItemCategory::count)> category_sizes_{};
+	///< Number of entries in each category, to size the filtered views.
+
+	std::vector<InventoryListener*> listeners_; ///< Everything following the
+	// changes, told in the order it subscribed.
+};
+
+/***
+ * @brief Iterator over the slots of an inventory, in the order of the list or 
+ * index it walks.
+ * 
+ * Dereferencing builds the slot from the entry on the spot, so it returns a 
+ * value rather than a reference. An iterator stays valid until its item is 
+ * removed, so a menu can keep the one where a page ends to start the next.
+ ***/
+template <typename Base>
+class Inventory::Iterator
+{
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type        = Slot;
+	using difference_type   = std::ptrdiff_t;
+	using pointer           = void;
+	using reference         = Slot;
+
+	Iterator() = default;
+
+	Slot
+	operator*()
+	const noexcept
+	{
+		const auto& entry = *it_;
+		return { entry.id_, entry.any().name(), entry.size() };
+	}
+
+	Iterator&
+	operator++()
+	noexcept
+	{
+		++it_;
+		return *this;
+	}
+
+	Iterator
+	operator++(int)
+	noexcept
+	{
+		auto old = *this;
+		++it_;
+		return old;
+	}
+
+	bool
+	operator==(const Iterator& other)
+	const noexcept
+	{
+		return it_ == other.it_;
+	}
+
+	bool
+	operator!=(const Iterator& other)
+	const noexcept
+	{
+		return it_ != other.it_;
+	}
+
+private:
+	friend class Inventory;
+
+	explicit
+	Iterator(Base it)
+	noexcept
+		: it_(it)
+	{
+	}
+
+	Base it_; ///< Current entry.
+};
+
+/***
+ * @brief Range over the slots of an inventory, in the order of the list or 
+ * index it views.
+ ***/
+template <typename Base>
+class Inventory::Range
+{
+public:
+	using const_iterator = Iterator<Base>;
+
+	const_iterator
+	begin()
+	const noexcept
+	{
+		return begin_;
+	}
+
+	const_iterator
+	end()
+	const noexcept
+	{
+		return end_;
+	}
+
+	/***
+	 * @brief Get the number of different items, i.e. of slots.
+	 * 
+	 * @return Number of slots.
+	 ***/
+	std::size_t
+	size()
+	const noexcept
+	{
+		return size_;
+	}
+
+	bool
+	empty()
+	const noexcept
+	{
+		return size_ == 0;
+	}
+
+	/***
+	 * @brief Get part of the range, such as one page of a menu.
+	 * 
+	 * Finding the start takes time linear in @p first. Paging forward from an 
+	 * iterator kept from the previous page avoids that.
+	 * 
+	 * @param first       - Index of the first slot.
+	 * @param count       - Number of slots, fewer if the range ends first.
+	 * 
+	 * @return The range over the selected slots.
+	 ***/
+	Range
+	page(const std::size_t first, const std::size_t count)
+	const noexcept
+	{
+		const auto n_skip = std::min(first, size_);
+		const auto n_keep = std::min(count, size_ - n_skip);
+		const auto begin = std::next(begin_, n_skip);
+		return { begin, std::next(begin, n_keep), n_keep };
+	}
+
+private:
+	friend class Inventory;
+
+	Range(
+		const const_iterator begin, 
+		const const_iterator end, 
+		const std::size_t size)
+	noexcept
+		: begin_(begin)
+		, end_  (end)
+		, size_ (size)
+	{
+	}
+
+	const_iterator begin_; ///< First slot.
+	const_iterator end_;   ///< Past the last slot.
+	std::size_t    size_;  ///< Number of slots.
+};
+
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+
+namespace nemo
+{
+
+/***
+ * @brief One change made to an inventory, as seen from its recency order.
+ * 
+ * Changes are reported in the order they happen, so a listener that applies 
+ * them one by one to its own copy of the order ends up with the inventory's.
+ ***/
+struct InventoryChange
+{
+	/***
+	 * @brief Enumeration for what happened to the item.
+	 ***/
+	enum class Type {
+		Added,        ///< New item, now at the front.
+		Removed,      ///< Last copy gone, no longer in the order.
+		CountChanged, ///< Same place, different quantity.
+		MovedToFront  ///< Same quantity, now at the front.
+	};
+
+	Type        type_;  ///< What happened to the item.
+	int         id_;    ///< Item's ID.
+	std::size_t count_; ///< Quantity after the change.
+};
+
+/***
+ * @brief Interface of anything that follows the changes made to an inventory, 
+ * such as a menu listing its items.
+ ***/
+class InventoryListener
+{
+public:
+	virtual
+	~InventoryListener()
+	= default;
+
+	/***
+	 * @brief Called right after the inventory has changed.
+	 * 
+	 * The inventory can already be viewed in its new state, but it must not be 
+	 * changed from here.
+	 * 
+	 * @param change      - What changed.
+	 ***/
+	virtual void
+	inventoryChanged(const InventoryChange& change)
+	= 0;
+};
+
+}
@@ -0,0 +1,69 @@
+#include "Item.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+Item::Item(const int id, const bool unique, const ItemCategory category)
+	: id_      (id)
+	, unique_  (unique)
+	, category_(category)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::shared_ptr<Item>
+Item::clone()
+const
+{
+	return std::make_shared<Item>(*this);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+int
+Item::id()
+const noexcept
+{
+	return id_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+const std::string&
+Item::name()
+const noexcept
+{
+	return name_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+Item::unique()
+const noexcept
+{
+	return unique_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+ItemCategory
+Item::category()
+const noexcept
+{
+	return category_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
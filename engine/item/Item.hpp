@@ -0,0 +1,104 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace nemo
+{
+
+/***
+ * @brief Kinds of items, by which the inventory groups them.
+ ***/
+enum class ItemCategory {
+	Weapon = 0, 
+	Armor, 
+	Consumable, ///< Healing items, etc.
+	Key,        ///< Story items that can't be discarded.
+	Misc, 
+
+	count
+};
+
+/***
+ * @brief Item, such as a weapon, an armor, a healing item, etc. Kinds of items 
+ * with more to them, such as weapons, derive from it and override @property 
+ * clone.
+ ***/
+class Item
+{
+public:
+	/***
+	 * @brief Construct an item.
+	 * 
+	 * @param id          - Item's ID.
+	 * @param unique      - Whether this copy differs from others with the same 
+	 *                      ID, e.g. an upgraded weapon, instead of being 
+	 *                      interchangeable with them, e.g. a potion.
+	 * @param category    - Kind of item. Every copy with the same ID must have 
+	 *                      the same one.
+	 ***/
+	Item(
+		const int id, 
+		const bool unique = false, 
+		const ItemCategory category = ItemCategory::Misc);
+
+	virtual
+	~Item()
+	= default;
+
+	/***
+	 * @brief Make a copy of the item, of the same derived type.
+	 * 
+	 * @return The copy.
+	 ***/
+	virtual std::shared_ptr<Item>
+	clone()
+	const;
+
+	/***
+	 * @brief Get the item's ID.
+	 * 
+	 * @return Item's ID.
+	 ***/
+	int
+	id()
+	const noexcept;
+
+	/***
+	 * @brief Get the item's name.
+	 * 
+	 * @return Item's name, which lives as long as the item does.
+	 ***/
+	const std::string&
+	name()
+	const noexcept;
+
+	/***
+	 * @brief Check whether the item must be kept as its own object.
+	 * 
+	 * Items that aren't unique are interchangeable with any other of the same 
+	 * ID, so an inventory only needs to keep one of them and a count.
+	 * 
+	 * @return True if the item is unique, false otherwise.
+	 ***/
+	bool
+	unique()
+	const noexcept;
+
+	/***
+	 * @brief Get the kind of item.
+	 * 
+	 * @return Item's category.
+	 ***/
+	ItemCategory
+	category()
+	const noexcept;
+
+private:
+	int          id_;       ///< Item's ID.
+	std::string  name_;     ///< Item's name.
+	bool         unique_;   ///< Differs from other copies.
+	ItemCategory category_; ///< Kind of item.
+};
+
+}
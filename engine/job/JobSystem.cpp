@@ -0,0 +1,245 @@
+#include <boost/assert.hpp>
+
+#include "JobSystem.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	// Job system the calling thread works for, and the index of its queue.
+	thread_local const JobSystem* tls_system = nullptr;
+	thread_local std::size_t tls_index = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+JobHandle::done()
+const noexcept
+{
+	return job_ == nullptr || job_->done_.load(std::memory_order_acquire);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+JobSystem::JobSystem(const std::size_t threads)
+	: queued_(0)
+	, stop_(false)
+{
+	BOOST_ASSERT(threads > 0);
+
+	// Queue 0 belongs to the thread that owns the job system.
+	for (std::size_t i = 0; i < threads; ++i) {
+		queues_.push_back(std::make_unique<Queue>());
+	}
+
+	for (std::size_t i = 1; i < threads; ++i) {
+		workers_.emplace_back(&JobSystem::work, this, i);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+JobSystem::~JobSystem()
+{
+	{
+		std::lock_guard lock(sleep_mutex_);
+		stop_ = true;
+	}
+	wake_.notify_all();
+
+	for (auto& worker : workers_) {
+		worker.join();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+JobHandle
+JobSystem::schedule(
+	std::function<void()> task, 
+	std::initializer_list<JobHandle> after)
+{
+	auto job = std::make_shared<detail::Job>(std::move(task));
+
+	for (const auto& dependency : after) {
+		if (dependency.job_ == nullptr) {
+			continue;
+		}
+
+		// If the dependency is still running, it will release this job when 
+		// it finishes.
+		auto& dep = *dependency.job_;
+		std::lock_guard lock(dep.mutex_);
+
+		if (!dep.done_.load(std::memory_order_relaxed)) {
+			job->waiting_on_.fetch_add(1, std::memory_order_relaxed);
+			dep.dependents_.push_back(job);
+		}
+	}
+
+	// Drop the hold that kept the job from being released while its 
+	// dependencies were being registered.
+	if (job->waiting_on_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+		push(job);
+	}
+
+	return { std::move(job) };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+JobSystem::wait(const JobHandle& handle)
+{
+	while (!handle.done()) {
+		if (const auto job = take(); job != nullptr) {
+			execute(job);
+		}
+		else {
+			// The job is running on another thread or is waiting on one.
+			std::this_thread::yield();
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+JobSystem::threadCount()
+const noexcept
+{
+	return queues_.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+JobSystem::work(const std::size_t index)
+{
+	tls_system = this;
+	tls_index = index;
+
+	while (true) {
+		if (const auto job = take(); job != nullptr) {
+			execute(job);
+			continue;
+		}
+
+		// Nothing to do. Sleep until a job is queued.
+		std::unique_lock lock(sleep_mutex_);
+		wake_.wait(lock, [this] { return stop_ || queued_ > 0; });
+
+		if (stop_) {
+			return;
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+JobSystem::push(std::shared_ptr<detail::Job> job)
+{
+	auto& queue = *queues_[queueIndex()];
+	{
+		std::lock_guard lock(queue.mutex_);
+		queue.jobs_.push_back(std::move(job));
+	}
+
+	// Counting under the sleep mutex makes sure a worker that is about to go 
+	// to sleep sees the new job.
+	{
+		std::lock_guard lock(sleep_mutex_);
+		++queued_;
+	}
+	wake_.notify_one();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::shared_ptr<detail::Job>
+JobSystem::take()
+{
+	if (queued_.load(std::memory_order_relaxed) == 0) {
+		return nullptr;
+	}
+
+	const auto own = queueIndex();
+	const auto n = queues_.size();
+
+	// Newest job from the thread's own queue first, then the oldest job from 
+	// each of the other queues in turn.
+	for (std::size_t i = 0; i < n; ++i) {
+		auto& queue = *queues_[(own + i) % n];
+		std::lock_guard lock(queue.mutex_);
+
+		if (queue.jobs_.empty()) {
+			continue;
+		}
+
+		std::shared_ptr<detail::Job> job;
+		if (i == 0) {
+			job = std::move(queue.jobs_.back());
+			queue.jobs_.pop_back();
+		}
+		else {
+			job = std::move(queue.jobs_.front());
+			queue.jobs_.pop_front();
+		}
+
+		--queued_;
+		return job;
+	}
+
+	return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+JobSystem::execute(const std::shared_ptr<detail::Job>& job)
+{
+	job->task_();
+
+	std::vector<std::shared_ptr<detail::Job>> dependents;
+	{
+		std::lock_guard lock(job->mutex_);
+		job->done_.store(true, std::memory_order_release);
+		dependents.swap(job->dependents_);
+	}
+
+	for (auto& dependent : dependents) {
+		if (dependent->waiting_on_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			push(std::move(dependent));
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+JobSystem::queueIndex()
+const noexcept
+{
+	return tls_system == this ? tls_index : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
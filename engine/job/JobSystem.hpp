@@ -0,0 +1,252 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nemo
+{
+
+class JobSystem;
+
+namespace detail
+{
+	/***
+	 * @brief A unit of work and the bookkeeping to run it after its 
+	 * dependencies.
+	 ***/
+	struct Job
+	{
+		std::function<void()> task_;  ///< Work to do.
+		std::atomic<int> waiting_on_; ///< Unfinished dependencies, plus one 
+		// while the job is still being scheduled.
+		std::atomic<bool> done_;      ///< The task has finished.
+		std::mutex mutex_;            ///< Guards the dependents.
+		std::vector<std::shared_ptr<Job>> dependents_; ///< Jobs waiting on this.
+
+		Job(std::function<void()>&& task)
+			: task_(std::move(task))
+			, waiting_on_(1)
+			, done_(false)
+		{
+		}
+	};
+}
+
+/***
+ * @brief Handle to a scheduled job, used to wait for it or to make other jobs 
+ * depend on it.
+ ***/
+class JobHandle
+{
+public:
+	/***
+	 * @brief Construct a handle to no job. Waiting on it returns immediately.
+	 ***/
+	JobHandle() = default;
+
+	/***
+	 * @brief Indicates whether the job has finished.
+	 * 
+	 * @return True if yes, or if the handle refers to no job. False otherwise.
+	 ***/
+	bool
+	done()
+	const noexcept;
+
+private:
+	friend class JobSystem;
+
+	JobHandle(std::shared_ptr<detail::Job> job)
+		: job_(std::move(job))
+	{
+	}
+
+	std::shared_ptr<detail::Job> job_; ///< Referenced job.
+};
+
+/***
+ * @brief Pool of worker threads that run jobs for the engine's subsystems.
+ * 
+ * Each thread, including the one that owns the job system, has its own queue. 
+ * A thread pushes and pops jobs at the back of its own queue, so recently 
+ * spawned (and likely cache-warm) work runs first. When a thread runs out of 
+ * work, it steals the oldest job from the front of another thread's queue.
+ * 
+ * Threads that wait on a job don't block; they keep running other jobs until 
+ * the one they wait on is done.
+ ***/
+class JobSystem
+{
+public:
+	/***
+	 * @brief Start the worker threads.
+	 * 
+	 * @param threads     - Number of threads to run jobs on, including the 
+	 *                      calling thread. With 1, no worker is started and 
+	 *                      every job runs inside @property wait.
+	 ***/
+	explicit JobSystem(
+		const std::size_t threads = std::max(1u, std::thread::hardware_concurrency()));
+
+	/***
+	 * @brief Stop the worker threads. Jobs that haven't started are dropped.
+	 ***/
+	~JobSystem();
+
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+	/***
+	 * @brief Schedule a job.
+	 * 
+	 * @param task        - Work to do.
+	 * @param after       - Jobs that must finish before this one starts.
+	 * 
+	 * @return Handle to the scheduled job.
+	 ***/
+	JobHandle
+	schedule(
+		std::function<void()> task, 
+		std::initializer_list<JobHandle> after = {});
+
+	/***
+	 * @brief Run jobs on the calling thread until a job has finished.
+	 * 
+	 * @param handle      - Job to wait for.
+	 ***/
+	void
+	wait(const JobHandle& handle);
+
+	/***
+	 * @brief Split an index range into chunks, run them across all threads, 
+	 * and wait for them to finish.
+	 * 
+	 * @param count       - Number of indices, starting from 0.
+	 * @param grain       - Minimum number of indices per chunk. 0 picks a 
+	 *                      size that gives each thread a few chunks.
+	 * @param body        - Callable taking the first index of a chunk and one 
+	 *                      past its last index.
+	 ***/
+	template <typename Body>
+	void
+	parallelFor(const std::size_t count, std::size_t grain, const Body& body);
+
+	/***
+	 * @brief Get the number of threads jobs run on, including the owner's.
+	 * 
+	 * @return Thread count.
+	 ***/
+	std::size_t
+	threadCount()
+	const noexcept;
+
+private:
+	/***
+	 * @brief A thread's queue of ready jobs.
+	 ***/
+	struct Queue
+	{
+		std::mutex mutex_;
+		std::deque<std::shared_ptr<detail::Job>> jobs_;
+	};
+
+	/***
+	 * @brief Body of a worker thread.
+	 * 
+	 * @param index       - Index of the thread's queue.
+	 ***/
+	void
+	work(const std::size_t index);
+
+	/***
+	 * @brief Queue a job whose dependencies have all finished.
+	 * 
+	 * @param job         - Ready job.
+	 ***/
+	void
+	push(std::shared_ptr<detail::Job> job);
+
+	/***
+	 * @brief Take a job from the calling thread's queue, or steal one from 
+	 * another thread.
+	 * 
+	 * @return A ready job, or nullptr if there is none.
+	 ***/
+	std::shared_ptr<detail::Job>
+	take();
+
+	/***
+	 * @brief Run a job and release the jobs depending on it.
+	 * 
+	 * @param job         - Job to run.
+	 ***/
+	void
+	execute(const std::shared_ptr<detail::Job>& job);
+
+	/***
+	 * @brief Get the index of the calling thread's queue.
+	 * 
+	 * @return Index of the worker's queue, or 0 for any thread that isn't one 
+	 * of this system's workers.
+	 ***/
+	std::size_t
+	queueIndex()
+	const noexcept;
+
+	/***
+	 * @brief Private attributes.
+	 ***/
+	std::vector<std::unique_ptr<Queue>> queues_; ///< One queue per thread.
+	std::vector<std::thread> workers_;  ///< Worker threads.
+	std::atomic<std::size_t> queued_;   ///< Jobs in all queues.
+	std::atomic<bool>        stop_;     ///< Workers should exit.
+	std::mutex               sleep_mutex_; ///< Guards idle workers.
+	std::condition_variable  wake_;     ///< Wakes idle workers.
+};
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename Body>
+void
+JobSystem::parallelFor(const std::size_t count, std::size_t grain, const Body& body)
+{
+	if (count == 0) {
+		return;
+	}
+
+	if (grain == 0) {
+		// A few chunks per thread leaves room for stealing to even out chunks 
+		// that take longer than others.
+		constexpr std::size_t chunks_per_thread = 4;
+		grain = std::max<std::size_t>(1, count / (threadCount() * chunks_per_thread));
+	}
+
+	if (threadCount() == 1 || count <= grain) {
+		body(std::size_t(0), count);
+		return;
+	}
+
+	std::vector<JobHandle> chunks;
+	chunks.reserve((count + grain - 1) / grain);
+
+	for (std::size_t first = 0; first < count; first += grain) {
+		const auto last = std::min(count, first + grain);
+		chunks.push_back(schedule([&body, first, last] { body(first, last); }));
+	}
+
+	for (const auto& chunk : chunks) {
+		wait(chunk);
+	}
+}
+
+}
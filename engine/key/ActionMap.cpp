@@ -0,0 +1,212 @@
+#include <algorithm>
+#include <boost/assert.hpp>
+
+#include "ActionMap.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	constexpr auto unbound = std::uint8_t(KeyAction::count);
+
+	// Key::Unknown is -1, so every code is shifted up by one.
+	std::size_t
+	index(const Key& k)
+	noexcept
+	{
+		return std::size_t(sf::Keyboard::Key(k) + 1);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+operator==(const Chord& a, const Chord& b)
+noexcept
+{
+	return a.key_ == b.key_ && a.modifiers_ == b.modifiers_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::uint8_t
+modifiers(const sf::Event::KeyEvent& event)
+noexcept
+{
+	return std::uint8_t(
+		(event.shift   ? std::uint8_t(Modifier::Shift)   : 0) 
+		| (event.control ? std::uint8_t(Modifier::Control) : 0) 
+		| (event.alt     ? std::uint8_t(Modifier::Alt)     : 0) 
+		| (event.system  ? std::uint8_t(Modifier::System)  : 0)
+	);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+ActionMap::ActionMap()
+noexcept
+	: stack_{ InputContext::Gameplay }
+	, active_(std::size_t(InputContext::Gameplay))
+{
+	for (auto& table : tables_) {
+		for (auto& row : table) {
+			row.fill(unbound);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::optional<KeyAction>
+ActionMap::convert(const Key& k, const std::uint8_t modifiers)
+const noexcept
+{
+	BOOST_ASSERT(index(k) < n_keys);
+
+	const auto action = tables_[active_][modifiers % n_modifier_sets][index(k)];
+
+	if (action == unbound) {
+		// Not a registered key.
+		return {};
+	}
+
+	return { KeyAction(action) };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+ActionMap::bind(
+	const InputContext context, 
+	const KeyAction action, 
+	const Chord& chord)
+{
+	BOOST_ASSERT(context < InputContext::count);
+	BOOST_ASSERT(action < KeyAction::count);
+	BOOST_ASSERT(index(chord.key_) < n_keys);
+	BOOST_ASSERT(chord.modifiers_ < n_modifier_sets);
+
+	auto& bindings = bindings_[std::size_t(context)];
+
+	// A chord means one thing per context.
+	for (auto& chords : bindings) {
+		chords.erase(
+			std::remove(chords.begin(), chords.end(), chord), 
+			chords.end()
+		);
+	}
+
+	bindings[std::size_t(action)].push_back(chord);
+	rebuild(context);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+ActionMap::unbind(const InputContext context, const KeyAction action)
+{
+	BOOST_ASSERT(context < InputContext::count);
+	BOOST_ASSERT(action < KeyAction::count);
+
+	bindings_[std::size_t(context)][std::size_t(action)].clear();
+	rebuild(context);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<Chord>&
+ActionMap::bindings(const InputContext context, const KeyAction action)
+const noexcept
+{
+	BOOST_ASSERT(context < InputContext::count);
+	BOOST_ASSERT(action < KeyAction::count);
+
+	return bindings_[std::size_t(context)][std::size_t(action)];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+ActionMap::push(const InputContext context)
+{
+	BOOST_ASSERT(context < InputContext::count);
+
+	stack_.push_back(context);
+	active_ = std::size_t(context);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+ActionMap::pop()
+noexcept
+{
+	BOOST_ASSERT(stack_.size() > 1);
+
+	if (stack_.size() > 1) {
+		stack_.pop_back();
+		active_ = std::size_t(stack_.back());
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+InputContext
+ActionMap::context()
+const noexcept
+{
+	return stack_.back();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+ActionMap::rebuild(const InputContext context)
+noexcept
+{
+	auto& table = tables_[std::size_t(context)];
+	const auto& bindings = bindings_[std::size_t(context)];
+
+	for (auto& row : table) {
+		row.fill(unbound);
+	}
+
+	// Plain keys first, in every row, so that they still work with any 
+	// modifiers held. Chords then take over their own row.
+	for (std::size_t action = 0; action < n_actions; ++action) {
+		for (const auto& chord : bindings[action]) {
+			if (chord.modifiers_ == 0) {
+				for (auto& row : table) {
+					row[index(chord.key_)] = std::uint8_t(action);
+				}
+			}
+		}
+	}
+
+	for (std::size_t action = 0; action < n_actions; ++action) {
+		for (const auto& chord : bindings[action]) {
+			if (chord.modifiers_ != 0) {
+				table[chord.modifiers_][index(chord.key_)] = std::uint8_t(action);
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
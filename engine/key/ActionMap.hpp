@@ -0,0 +1,186 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include <SFML/Window/Event.hpp>
+#include <SFML/Window/Keyboard.hpp>
+
+#include "utility/type/Key.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Situations in which the same keys mean different things.
+ ***/
+enum class InputContext {
+	Gameplay = 0,
+	Menu,
+	Text,
+
+	count
+};
+
+/***
+ * @brief Keys held down along with another key. A set of them is stored as 
+ * the bitwise or of the values.
+ ***/
+enum class Modifier : std::uint8_t {
+	Shift   = 1 << 0,
+	Control = 1 << 1,
+	Alt     = 1 << 2,
+	System  = 1 << 3,
+};
+
+/***
+ * @brief A key, pressed while holding a set of modifiers. A chord without 
+ * modifiers is a plain key.
+ ***/
+struct Chord
+{
+	Key          key_;           ///< Key pressed last.
+	std::uint8_t modifiers_ = 0; ///< Modifiers held, @enum Modifier bits.
+};
+
+/***
+ * @brief Compare chords.
+ * 
+ * @return True if both the key and the modifiers are the same.
+ ***/
+bool
+operator==(const Chord& a, const Chord& b)
+noexcept;
+
+/***
+ * @brief Get the modifiers held during a key event.
+ * 
+ * @param event       - Key event.
+ * 
+ * @return Set of @enum Modifier bits.
+ ***/
+std::uint8_t
+modifiers(const sf::Event::KeyEvent& event)
+noexcept;
+
+/***
+ * @brief Maps keys to controls, for each @enum InputContext.
+ * 
+ * Each control can have any number of chords bound to it, and a chord is 
+ * bound to at most one control per context. Contexts are kept on a stack, 
+ * e.g. a menu pushes its own on top of the gameplay one, and only the one on 
+ * top translates keys.
+ * 
+ * Bindings are compiled into a dense table per context, indexed by modifiers 
+ * and key code, so translating a key is a single load. A plain key also 
+ * answers when modifiers are held, unless a chord of those modifiers is bound.
+ ***/
+class ActionMap
+{
+public:
+	/***
+	 * @brief Construct a map with no bindings, in the gameplay context.
+	 ***/
+	ActionMap() 
+	noexcept;
+
+	/***
+	 * @brief Get the control a key maps to in the current context.
+	 * 
+	 * @param k           - Key.
+	 * @param modifiers   - Modifiers held, @enum Modifier bits.
+	 * 
+	 * @return The control associated with that key. Or nothing if there is 
+	 * none associated with it.
+	 ***/
+	std::optional<KeyAction>
+	convert(const Key& k, const std::uint8_t modifiers = 0)
+	const noexcept;
+
+	/***
+	 * @brief Bind a chord to a control, taking it away from any other control 
+	 * of that context.
+	 * 
+	 * @param context     - Context the binding applies to.
+	 * @param action      - Control.
+	 * @param chord       - Key and modifiers.
+	 ***/
+	void
+	bind(const InputContext context, const KeyAction action, const Chord& chord);
+
+	/***
+	 * @brief Remove all the chords bound to a control.
+	 * 
+	 * @param context     - Context the bindings apply to.
+	 * @param action      - Control.
+	 ***/
+	void
+	unbind(const InputContext context, const KeyAction action);
+
+	/***
+	 * @brief Get the chords bound to a control, in the order they were bound.
+	 * 
+	 * @param context     - Context the bindings apply to.
+	 * @param action      - Control.
+	 * 
+	 * @return Chords.
+	 ***/
+	const std::vector<Chord>&
+	bindings(const InputContext context, const KeyAction action)
+	const noexcept;
+
+	/***
+	 * @brief Make a context the current one, until it is popped.
+	 * 
+	 * @param context     - New context.
+	 ***/
+	void
+	push(const InputContext context);
+
+	/***
+	 * @brief Go back to the context before the last push. The first context 
+	 * is never popped.
+	 ***/
+	void
+	pop()
+	noexcept;
+
+	/***
+	 * @brief Get the current context.
+	 * 
+	 * @return Context on top of the stack.
+	 ***/
+	InputContext
+	context()
+	const noexcept;
+
+private:
+	static constexpr auto n_keys = std::size_t(sf::Keyboard::KeyCount) + 1;
+	static constexpr auto n_modifier_sets = std::size_t(16);
+	static constexpr auto n_actions = std::size_t(KeyAction::count);
+	static constexpr auto n_contexts = std::size_t(InputContext::count);
+
+	// One byte per entry, KeyAction::count where nothing is bound. A whole 
+	// table is about 1.6 kB.
+	using Table = std::array<std::array<std::uint8_t, n_keys>, n_modifier_sets>;
+	using Bindings = std::array<std::vector<Chord>, n_actions>;
+
+	/***
+	 * @brief Compile the table of a context from its bindings.
+	 ***/
+	void
+	rebuild(const InputContext context)
+	noexcept;
+
+	/***
+	 * @brief Private attributes.
+	 ***/
+	std::array<Bindings, n_contexts> bindings_; ///< Chords of each control.
+	std::array<Table, n_contexts>    tables_;   ///< Compiled bindings.
+	std::vector<InputContext>        stack_;    ///< Contexts, current last.
+	std::size_t                      active_;   ///< Index of the current one.
+};
+
+}
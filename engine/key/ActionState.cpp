@@ -0,0 +1,132 @@
+#include <boost/assert.hpp>
+
+#include "ActionState.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+ActionState::ActionState()
+noexcept
+{
+	keys_.fill(0);
+	steps_.fill(0);
+	delay_.fill(0);
+	interval_.fill(0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+ActionState::setRepeat(
+	const KeyAction action, 
+	const std::uint32_t delay, 
+	const std::uint32_t interval)
+noexcept
+{
+	BOOST_ASSERT(action < KeyAction::count);
+	BOOST_ASSERT(delay > 0 || interval == 0);
+
+	delay_[std::size_t(action)] = delay;
+	interval_[std::size_t(action)] = interval;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+ActionState::update(
+	const std::vector<TimedInput>& inputs, 
+	const TimePoint now, 
+	std::vector<TimedInput>& presses)
+{
+	pressed_.reset();
+	released_.reset();
+
+	for (const auto& input : inputs) {
+		const auto a = std::size_t(input.action_);
+		BOOST_ASSERT(a < n_actions);
+
+		if (!input.released_) {
+			// Only the first of several keys bound to the control presses it.
+			if (keys_[a]++ == 0) {
+				held_.set(a);
+				pressed_.set(a);
+				steps_[a] = 0;
+				presses.push_back(input);
+			}
+		}
+		else if (keys_[a] > 0 && --keys_[a] == 0) {
+			held_.reset(a);
+			released_.set(a);
+		}
+	}
+
+	for (std::size_t a = 0; a < n_actions; ++a) {
+		if (!held_.test(a) || pressed_.test(a)) {
+			continue;
+		}
+
+		// Pressed again after the delay, then once every interval.
+		const auto steps = ++steps_[a];
+		if (interval_[a] != 0 
+			&& steps >= delay_[a] 
+			&& (steps - delay_[a]) % interval_[a] == 0) {
+			presses.push_back({ KeyAction(a), now });
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+ActionState::pressed(const KeyAction action)
+const noexcept
+{
+	BOOST_ASSERT(action < KeyAction::count);
+
+	return pressed_.test(std::size_t(action));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+ActionState::held(const KeyAction action)
+const noexcept
+{
+	BOOST_ASSERT(action < KeyAction::count);
+
+	return held_.test(std::size_t(action));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+ActionState::released(const KeyAction action)
+const noexcept
+{
+	BOOST_ASSERT(action < KeyAction::count);
+
+	return released_.test(std::size_t(action));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+ActionState::anyHeld()
+const noexcept
+{
+	return held_.any();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
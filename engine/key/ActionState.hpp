@@ -0,0 +1,129 @@
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "loop/InputQueue.hpp"
+#include "utility/type/Key.hpp"
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief State of every control at the current simulation step, built from 
+ * the presses and releases due for each step.
+ * 
+ * The controls held, and the ones that went down or up during the current 
+ * step, are kept as bitsets, so asking whether a control was pressed, is 
+ * held, or was released is a single bit test. The edges are collected from 
+ * the inputs instead of comparing with the previous step, so that a press and 
+ * a release within the same step, i.e. a short tap, isn't lost. A control 
+ * bound to several keys is held as long as any of them is.
+ * 
+ * Controls can repeat while held: after a delay, they are pressed again at a 
+ * fixed interval. Both are counted in simulation steps, so repeats happen at 
+ * the same steps no matter the frame rate, and replays reproduce them.
+ ***/
+class ActionState
+{
+public:
+	/***
+	 * @brief Construct a state with nothing held and no repeat.
+	 ***/
+	ActionState()
+	noexcept;
+
+	/***
+	 * @brief Make a control repeat while held, or stop it from repeating.
+	 * 
+	 * @param action      - Control.
+	 * @param delay       - Steps between the press and the first repeat. 
+	 *                      Must be at least 1.
+	 * @param interval    - Steps between repeats, 0 for no repeat.
+	 ***/
+	void
+	setRepeat(
+		const KeyAction action, 
+		const std::uint32_t delay, 
+		const std::uint32_t interval)
+	noexcept;
+
+	/***
+	 * @brief Advance to the next simulation step.
+	 * 
+	 * @param inputs      - Presses and releases due for the step, oldest first.
+	 * @param now         - Time of the step, given to repeated presses.
+	 * @param presses     - Container to append the step's presses to, 
+	 *                      followed by the repeats. It is not cleared 
+	 *                      beforehand.
+	 ***/
+	void
+	update(
+		const std::vector<TimedInput>& inputs, 
+		const TimePoint now, 
+		std::vector<TimedInput>& presses);
+
+	/***
+	 * @brief Indicates whether a control went down during the current step.
+	 * Repeats don't count.
+	 * 
+	 * @param action      - Control.
+	 * 
+	 * @return True if yes, false otherwise.
+	 ***/
+	bool
+	pressed(const KeyAction action)
+	const noexcept;
+
+	/***
+	 * @brief Indicates whether a control is down at the end of the current 
+	 * step.
+	 * 
+	 * @param action      - Control.
+	 * 
+	 * @return True if yes, false otherwise.
+	 ***/
+	bool
+	held(const KeyAction action)
+	const noexcept;
+
+	/***
+	 * @brief Indicates whether a control was let go during the current step.
+	 * 
+	 * @param action      - Control.
+	 * 
+	 * @return True if yes, false otherwise.
+	 ***/
+	bool
+	released(const KeyAction action)
+	const noexcept;
+
+	/***
+	 * @brief Indicates whether any control is held.
+	 * 
+	 * @return True if yes, false otherwise.
+	 ***/
+	bool
+	anyHeld()
+	const noexcept;
+
+private:
+	static constexpr auto n_actions = std::size_t(KeyAction::count);
+
+	/***
+	 * @brief Private attributes.
+	 ***/
+	std::bitset<n_actions>                  held_;     ///< Down now.
+	std::bitset<n_actions>                  pressed_;  ///< Went down this step.
+	std::bitset<n_actions>                  released_; ///< Let go this step.
+	std::array<std::uint8_t, n_actions>     keys_;     ///< Keys holding each.
+	std::array<std::uint32_t, n_actions>    steps_;    ///< Steps held.
+	std::array<std::uint32_t, n_actions>    delay_;    ///< Steps to repeat.
+	std::array<std::uint32_t, n_actions>    interval_; ///< Steps per repeat.
+};
+
+}
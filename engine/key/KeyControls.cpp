@@ -1,8 +1,7 @@
-#include <fstream>
-#include <iomanip>
-#include <boost/container/flat_map.hpp>
+#include <array>
+#include <optional>
+#include <utility>
 #include <SFML/Window/Keyboard.hpp>
-#include <SFML/Window/Event.hpp>
 
 #include "nlohmann/json.hpp"
 #include "utility/type/Key.hpp"
@@ -15,32 +14,170 @@ namespace nemo
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace {
-	// For the json file storing the configurations, if you want to change a key 
-	// name, the path of the file, or the indentation, then change the literals 
-	// below.
-	constexpr auto key_up     = "up";
-	constexpr auto key_down   = "down";
-	constexpr auto key_left   = "left";
-	constexpr auto key_right  = "right";
-	constexpr auto key_select = "select";
-	constexpr auto key_cancel = "cancel";
-	constexpr auto key_pause  = "pause";
-
-	constexpr auto path = "data/settings/controls.json";
-	constexpr auto indent = 4;
+	// For the settings document storing the configurations, if you want to 
+	// change a key name or the name of the document, then change the literals 
+	// below. Names are in the order of their enums.
+	constexpr std::array<const char*, std::size_t(InputContext::count)> 
+	context_names = { "gameplay", "menu", "text" };
+
+	constexpr std::array<const char*, std::size_t(KeyAction::count)> 
+	action_names = { "up", "down", "left", "right", "select", "cancel", "pause" };
+
+	constexpr auto key_key     = "key";
+	constexpr auto key_shift   = "shift";
+	constexpr auto key_control = "control";
+	constexpr auto key_alt     = "alt";
+	constexpr auto key_system  = "system";
+
+	constexpr std::array<std::pair<const char*, Modifier>, 4> modifier_names = {{
+		{ key_shift,   Modifier::Shift   },
+		{ key_control, Modifier::Control },
+		{ key_alt,     Modifier::Alt     },
+		{ key_system,  Modifier::System  },
+	}};
+
+	constexpr auto document = "controls";
+
+	struct DefaultBinding
+	{
+		InputContext       context_;
+		KeyAction          action_;
+		sf::Keyboard::Key  key_;
+	};
+
+	// Text entry keeps the letters for typing.
+	constexpr DefaultBinding defaults[] = {
+		{ InputContext::Gameplay, KeyAction::Up,     sf::Keyboard::W         },
+		{ InputContext::Gameplay, KeyAction::Up,     sf::Keyboard::Up        },
+		{ InputContext::Gameplay, KeyAction::Down,   sf::Keyboard::S         },
+		{ InputContext::Gameplay, KeyAction::Down,   sf::Keyboard::Down      },
+		{ InputContext::Gameplay, KeyAction::Left,   sf::Keyboard::A         },
+		{ InputContext::Gameplay, KeyAction::Left,   sf::Keyboard::Left      },
+		{ InputContext::Gameplay, KeyAction::Right,  sf::Keyboard::D         },
+		{ InputContext::Gameplay, KeyAction::Right,  sf::Keyboard::Right     },
+		{ InputContext::Gameplay, KeyAction::Select, sf::Keyboard::P         },
+		{ InputContext::Gameplay, KeyAction::Cancel, sf::Keyboard::O         },
+		{ InputContext::Gameplay, KeyAction::Pause,  sf::Keyboard::Backspace },
+		{ InputContext::Gameplay, KeyAction::Pause,  sf::Keyboard::Escape    },
+
+		{ InputContext::Menu,     KeyAction::Up,     sf::Keyboard::W         },
+		{ InputContext::Menu,     KeyAction::Up,     sf::Keyboard::Up        },
+		{ InputContext::Menu,     KeyAction::Down,   sf::Keyboard::S         },
+		{ InputContext::Menu,     KeyAction::Down,   sf::Keyboard::Down      },
+		{ InputContext::Menu,     KeyAction::Left,   sf::Keyboard::A         },
+		{ InputContext::Menu,     KeyAction::Left,   sf::Keyboard::Left      },
+		{ InputContext::Menu,     KeyAction::Right,  sf::Keyboard::D         },
+		{ InputContext::Menu,     KeyAction::Right,  sf::Keyboard::Right     },
+		{ InputContext::Menu,     KeyAction::Select, sf::Keyboard::P         },
+		{ InputContext::Menu,     KeyAction::Select, sf::Keyboard::Enter     },
+		{ InputContext::Menu,     KeyAction::Cancel, sf::Keyboard::O         },
+		{ InputContext::Menu,     KeyAction::Cancel, sf::Keyboard::Escape    },
+		{ InputContext::Menu,     KeyAction::Pause,  sf::Keyboard::Backspace },
+
+		{ InputContext::Text,     KeyAction::Left,   sf::Keyboard::Left      },
+		{ InputContext::Text,     KeyAction::Right,  sf::Keyboard::Right     },
+		{ InputContext::Text,     KeyAction::Select, sf::Keyboard::Enter     },
+		{ InputContext::Text,     KeyAction::Cancel, sf::Keyboard::Escape    },
+	};
+
+	// Read a binding, either a key code or an object with the key code and 
+	// the modifiers set to true. Nothing if the key code isn't a key.
+	std::optional<Chord>
+	toChord(const nlohmann::json& js)
+	{
+		const auto& code = js.is_number() ? js : js.at(key_key);
+		const auto key = code.get<int>();
+
+		if (key < sf::Keyboard::Unknown || key >= sf::Keyboard::KeyCount) {
+			return {};
+		}
+
+		Chord chord{ Key(sf::Keyboard::Key(key)) };
+		if (!js.is_number()) {
+			for (const auto& [name, modifier] : modifier_names) {
+				if (js.contains(name) && js.at(name).get<bool>()) {
+					chord.modifiers_ |= std::uint8_t(modifier);
+				}
+			}
+		}
+
+		return { chord };
+	}
+
+	// Before contexts, the document mapped each control name straight to one 
+	// key code, e.g. {"up": 22, ...}.
+	bool
+	isFlat(const nlohmann::json& js)
+	{
+		if (!js.is_object()) {
+			return false;
+		}
+
+		for (const auto name : context_names) {
+			if (js.contains(name)) {
+				return false;
+			}
+		}
+
+		for (const auto name : action_names) {
+			if (js.contains(name)) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	// Carry the keys of a flat document over to the contexts that existed 
+	// back then, gameplay and menus, in the current layout.
+	nlohmann::json
+	fromFlat(const nlohmann::json& flat)
+	{
+		nlohmann::json js;
+
+		constexpr InputContext contexts[] = { 
+			InputContext::Gameplay, InputContext::Menu 
+		};
+
+		for (const auto context : contexts) {
+			const auto context_name = context_names[std::size_t(context)];
+			for (const auto name : action_names) {
+				if (flat.contains(name)) {
+					auto chords = nlohmann::json::array();
+					chords.push_back(flat.at(name));
+					js[context_name][name] = chords;
+				}
+			}
+		}
+
+		return js;
+	}
+
+	nlohmann::json
+	toJson(const Chord& chord)
+	{
+		if (chord.modifiers_ == 0) {
+			return sf::Keyboard::Key(chord.key_);
+		}
+
+		nlohmann::json js;
+		js[key_key] = sf::Keyboard::Key(chord.key_);
+		for (const auto& [name, modifier] : modifier_names) {
+			if (chord.modifiers_ & std::uint8_t(modifier)) {
+				js[name] = true;
+			}
+		}
+
+		return js;
+	}
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 
-KeyControls::KeyControls()
-	: map_(
-		[](const Key a, const Key b) {
-			return a < b;
-		}
-	)
+KeyControls::KeyControls(SettingsService& settings)
+	: settings_(settings)
 {
-	map_.reserve(static_cast<size_t>(KeyAction::count));
 	load();
 }
 
@@ -59,31 +196,39 @@ void
 KeyControls::load()
 {
 	try {
-		// Parse the json file.
-		std::ifstream ifs(path);
-		ifs.exceptions(std::ios::failbit | std::ios::badbit);
-		nlohmann::json js;
-		ifs >> js;
-
-		set(
-			Up     { js.at(key_up)     }, 
-			Down   { js.at(key_down)   }, 
-			Left   { js.at(key_left)   },
-			Right  { js.at(key_right)  },
-			Select { js.at(key_select) },
-			Cancel { js.at(key_cancel) },
-			Pause  { js.at(key_pause)  }
-		);
-	}
-	catch (const std::ios_base::failure& e) {
-		// Some error trying to read the file.
-		// Use default controls.
-		set();
+		// Null if there's no file yet, in which case every control gets its 
+		// default keys. A document from an older version is converted, so the 
+		// player keeps their keys, and saved in the current layout.
+		const auto loaded = settings_.load(document);
+		const auto js = isFlat(loaded) ? fromFlat(loaded) : loaded;
+
+		for (std::size_t c = 0; c < context_names.size(); ++c) {
+			const auto context = InputContext(c);
+
+			for (std::size_t a = 0; a < action_names.size(); ++a) {
+				const auto action = KeyAction(a);
+
+				if (!js.contains(context_names[c]) 
+					|| !js.at(context_names[c]).contains(action_names[a])) {
+					// Not in the file, e.g. a control added since.
+					reset(context, action);
+					continue;
+				}
+
+				const auto& chords = js.at(context_names[c]).at(action_names[a]);
+				map_.unbind(context, action);
+				for (const auto& binding : chords) {
+					if (const auto chord = toChord(binding)) {
+						map_.bind(context, action, *chord);
+					}
+				}
+			}
+		}
 	}
-	catch (const nlohmann::json::out_of_range& e) {
-		// Cannot find a key name in the file.
+	catch (const nlohmann::json::exception& e) {
+		// A binding has the wrong type.
 		// Use default controls.
-		set();
+		reset();
 	}
 }
 
@@ -96,70 +241,78 @@ const
 {
 	nlohmann::json js;
 	
-	for (auto m : map_) {
-		const auto [key, action] = m;
-
-		// JSON content.
-		switch (action) {
-			case KeyAction::Up:     js[key_up]     = sf::Keyboard::Key(key); break;
-			case KeyAction::Down:   js[key_down]   = sf::Keyboard::Key(key); break;
-			case KeyAction::Left:   js[key_left]   = sf::Keyboard::Key(key); break;
-			case KeyAction::Right:  js[key_right]  = sf::Keyboard::Key(key); break;
-			case KeyAction::Select: js[key_select] = sf::Keyboard::Key(key); break;
-			case KeyAction::Cancel: js[key_cancel] = sf::Keyboard::Key(key); break;
-			case KeyAction::Pause:  js[key_pause]  = sf::Keyboard::Key(key); break;
-			default: break;
+	for (std::size_t c = 0; c < context_names.size(); ++c) {
+		for (std::size_t a = 0; a < action_names.size(); ++a) {
+			auto chords = nlohmann::json::array();
+			for (const auto& chord : map_.bindings(InputContext(c), KeyAction(a))) {
+				chords.push_back(toJson(chord));
+			}
+
+			// JSON content.
+			js[context_names[c]][action_names[a]] = chords;
 		}
-	};
+	}
 
-	// Save it to the file.
-	std::ofstream ofs(path);
-	ofs << std::setw(indent) << js << std::endl;	
+	// Saved in the background, if anything changed.
+	settings_.store(document, js);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+KeyControls::reset()
+{
+	for (std::size_t c = 0; c < context_names.size(); ++c) {
+		for (std::size_t a = 0; a < action_names.size(); ++a) {
+			reset(InputContext(c), KeyAction(a));
+		}
+	}
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 
 std::optional<KeyAction> 
-KeyControls::convert(const Key& k) 
+KeyControls::convert(const Key& k, const std::uint8_t modifiers) 
 const noexcept
 {
-	const auto it = map_.find(k);
+	return map_.convert(k, modifiers);
+}
 
-	if (it == map_.cend()) {
-		// Not a registered key.
-		return {};
-	}
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
 
-	[[maybe_unused]] const auto [UNUSED_, action] = *it;
-	return { action };
+ActionMap&
+KeyControls::actions()
+noexcept
+{
+	return map_;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 
-void 
-KeyControls::set(
-	Up     up,
-	Down   down,
-	Left   left,
-	Right  right,
-	Select select,
-	Cancel cancel,
-	Pause  pause
-) noexcept
+const ActionMap&
+KeyControls::actions()
+const noexcept
 {
-	// This is to prevent lingering mappings when new keys are used
-	map_.clear();
-
-	// New mappings.
-	map_[up]     = KeyAction::Up;
-	map_[down]   = KeyAction::Down;
-	map_[left]   = KeyAction::Left;
-	map_[right]  = KeyAction::Right;
-	map_[select] = KeyAction::Select;
-	map_[cancel] = KeyAction::Cancel;
-	map_[pause]  = KeyAction::Pause;
+	return map_;
 }
 
-}
\ No newline at end of file
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+KeyControls::reset(const InputContext context, const KeyAction action)
+{
+	map_.unbind(context, action);
+
+	for (const auto& binding : defaults) {
+		if (binding.context_ == context && binding.action_ == action) {
+			map_.bind(context, action, Chord{ Key(binding.key_) });
+		}
+	}
+}
+
+}
@@ -1,10 +1,10 @@
 #pragma once
 
-#include <functional>
+#include <cstdint>
 #include <optional>
-#include <boost/container/flat_map.hpp>
-#include <SFML/Window/Keyboard.hpp>
 
+#include "key/ActionMap.hpp"
+#include "settings/SettingsService.hpp"
 #include "utility/type/Key.hpp"
 
 namespace nemo
@@ -19,32 +19,45 @@ public:
 	/***
 	 * @brief Construct the controls.
 	 * 
-	 * This constructor reads from a json file containing the keys mapped to 
-	 * the controls. If there is an error reading the file for any reason (the
-	 * keys in the file are incorrectly named, the file doesn't exist, etc.), it
-	 * loads with the game's default settings.
+	 * This constructor reads the "controls" settings document, which holds the 
+	 * keys mapped to the controls. If there is an error reading it for any 
+	 * reason (the keys in the file are incorrectly named, the file doesn't 
+	 * exist, etc.), it loads with the game's default settings. Controls 
+	 * missing from the document get their default keys. A document in the 
+	 * layout from before contexts, one key per control, gives its keys to 
+	 * both the gameplay and menu contexts.
+	 * 
+	 * @param settings    - Where the configurations are kept. Must outlive 
+	 *                      the controls.
 	 ***/
-	KeyControls();
+	explicit
+	KeyControls(SettingsService& settings);
 
 	/***
 	 * @brief Destroy the controls.
 	 * 
-	 * Before the object is destroyed, it saves the key configurations to a json
-	 * file that the constructor will read off of next time. If the file doesn't
-	 * exist, it creates one.
+	 * Before the object is destroyed, it hands the key configurations to the 
+	 * settings, which save them in the background if they changed.
 	 ***/
 	~KeyControls();
 	
 	/***
-	 * @brief Set the controls to the key configurations found in the json file.
+	 * @brief Set the controls to the key configurations found in the settings.
 	 ***/
 	void load();
 
 	/***
-	 * @brief Update the JSON file with the current key configurations.
+	 * @brief Update the settings with the current key configurations. Nothing 
+	 * is written to disk on this thread, and nothing at all if they haven't 
+	 * changed.
 	 ***/
 	void save() const;
 
+	/***
+	 * @brief Set every context back to the game's default controls.
+	 ***/
+	void reset();
+
 	/***
 	 * @brief Get the control associated with a pressed key.
 	 * 
@@ -52,49 +65,41 @@ public:
 	 * and down. This method would return the left command for A being pressed, 
 	 * up command for W being pressed, etc..
 	 * 
-	 * @param k    - Key.
+	 * @param k           - Key.
+	 * @param modifiers   - Modifiers held, @enum Modifier bits.
 	 * 
-	 * @return The control associated with that event. Or nothing if there is 
-	 * none associated with it.
+	 * @return The control associated with that event in the current context. 
+	 * Or nothing if there is none associated with it.
 	 ***/
 	std::optional<KeyAction>
-	convert(const Key& k) 
+	convert(const Key& k, const std::uint8_t modifiers = 0) 
 	const noexcept;
 
-private:
-	struct Up     : public Key { using Key::Key; };
-	struct Down   : public Key { using Key::Key; };
-	struct Left   : public Key { using Key::Key; };
-	struct Right  : public Key { using Key::Key; };
-	struct Select : public Key { using Key::Key; };
-	struct Cancel : public Key { using Key::Key; };
-	struct Pause  : public Key { using Key::Key; };
+	/***
+	 * @brief Get the bindings, to change them or switch contexts.
+	 * 
+	 * @return Map of every context.
+	 ***/
+	ActionMap&
+	actions()
+	noexcept;
 
-	///< All the keys and what controls they mapped to are stored here.
-	boost::container::flat_map< Key, KeyAction, 
-		std::function <bool (const Key&, const Key&)> 
-	> map_;
+	const ActionMap&
+	actions()
+	const noexcept;
 
+private:
 	/***
-	 * @brief Set the current controls of the game.
+	 * @brief Set a control of a context back to its default keys.
 	 * 
-	 * @param up        - New up key setting.
-	 * @param down      - New down key setting.
-	 * @param left      - New left key setting.
-	 * @param right     - New right key setting.
-	 * @param select    - New select key setting.
-	 * @param cancel    - New cancel key setting.
-	 * @param pause     - New pause key setting.
-	 */
-	void set(
-		Up     up     = Up     (sf::Keyboard::W),
-		Down   down   = Down   (sf::Keyboard::S),
-		Left   left   = Left   (sf::Keyboard::A),
-		Right  right  = Right  (sf::Keyboard::D),
-		Select select = Select (sf::Keyboard::P),
-		Cancel cancel = Cancel (sf::Keyboard::O),
-		Pause  pause  = Pause  (sf::Keyboard::Backspace)
-	) noexcept;
+	 * @param context     - Context.
+	 * @param action      - Control.
+	 ***/
+	void
+	reset(const InputContext context, const KeyAction action);
+
+	SettingsService& settings_; ///< Where the configurations are kept.
+	ActionMap        map_;      ///< Keys and the controls they map to.
 };
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,121 @@
+#include <boost/assert.hpp>
+
+#include "KeyboardState.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	constexpr auto unbound = std::uint8_t(KeyAction::count);
+
+	// Key::Unknown is -1, so every code is shifted up by one.
+	std::size_t
+	index(const Key& k)
+	noexcept
+	{
+		return std::size_t(sf::Keyboard::Key(k) + 1);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+KeyboardState::KeyboardState()
+noexcept
+{
+	actions_.fill(unbound);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::optional<KeyAction>
+KeyboardState::press(const Key& k, const std::optional<KeyAction> action)
+noexcept
+{
+	const auto i = index(k);
+	BOOST_ASSERT(i < n_keys);
+
+	if (down_.test(i)) {
+		// Repeated by the platform.
+		return {};
+	}
+
+	down_.set(i);
+	actions_[i] = action ? std::uint8_t(*action) : unbound;
+	return action;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::optional<KeyAction>
+KeyboardState::release(const Key& k)
+noexcept
+{
+	const auto i = index(k);
+	BOOST_ASSERT(i < n_keys);
+
+	if (!down_.test(i)) {
+		// Went down before the window had the focus.
+		return {};
+	}
+
+	down_.reset(i);
+	const auto action = actions_[i];
+	actions_[i] = unbound;
+
+	if (action == unbound) {
+		return {};
+	}
+
+	return { KeyAction(action) };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+KeyboardState::releaseAll(std::vector<KeyAction>& released)
+{
+	for (std::size_t i = 0; i < n_keys && down_.any(); ++i) {
+		if (down_.test(i)) {
+			if (actions_[i] != unbound) {
+				released.push_back(KeyAction(actions_[i]));
+			}
+
+			down_.reset(i);
+			actions_[i] = unbound;
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+KeyboardState::down(const Key& k)
+const noexcept
+{
+	BOOST_ASSERT(index(k) < n_keys);
+
+	return down_.test(index(k));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+KeyboardState::count()
+const noexcept
+{
+	return down_.count();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include <SFML/Window/Keyboard.hpp>
+
+#include "utility/type/Key.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Which keys are down, kept up to date from the platform's key events, 
+ * and the control each of them triggered when it went down.
+ * 
+ * A key that is already down doesn't trigger anything again, so the platform's 
+ * own key repeat is ignored. A key lets go of the control it triggered, even if 
+ * the bindings or the modifiers changed while it was down.
+ ***/
+class KeyboardState
+{
+public:
+	/***
+	 * @brief Construct a keyboard with no key down.
+	 ***/
+	KeyboardState()
+	noexcept;
+
+	/***
+	 * @brief Record a key going down.
+	 * 
+	 * @param k           - Key.
+	 * @param action      - Control the key is bound to, if any.
+	 * 
+	 * @return The control triggered. Nothing if the key isn't bound or was 
+	 * already down.
+	 ***/
+	std::optional<KeyAction>
+	press(const Key& k, const std::optional<KeyAction> action)
+	noexcept;
+
+	/***
+	 * @brief Record a key going up.
+	 * 
+	 * @param k           - Key.
+	 * 
+	 * @return The control the key triggered when it went down. Nothing if it 
+	 * wasn't bound or wasn't down.
+	 ***/
+	std::optional<KeyAction>
+	release(const Key& k)
+	noexcept;
+
+	/***
+	 * @brief Let go of every key, e.g. when the window loses the focus and 
+	 * won't see them go up.
+	 * 
+	 * @param released    - Container to append the controls let go to. It is 
+	 *                      not cleared beforehand.
+	 ***/
+	void
+	releaseAll(std::vector<KeyAction>& released);
+
+	/***
+	 * @brief Indicates whether a key is down.
+	 * 
+	 * @param k           - Key.
+	 * 
+	 * @return True if yes, false otherwise.
+	 ***/
+	bool
+	down(const Key& k)
+	const noexcept;
+
+	/***
+	 * @brief Get the number of keys down.
+	 * 
+	 * @return Key count.
+	 ***/
+	std::size_t
+	count()
+	const noexcept;
+
+private:
+	static constexpr auto n_keys = std::size_t(sf::Keyboard::KeyCount) + 1;
+
+	std::bitset<n_keys>               down_;    ///< Keys down.
+	std::array<std::uint8_t, n_keys>  actions_; ///< Control each key triggered.
+};
+
+}
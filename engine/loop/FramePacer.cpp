@@ -0,0 +1,88 @@
+#include <boost/assert.hpp>
+
+#include "FramePacer.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+FramePacer::FramePacer(
+	const unsigned int active_rate, 
+	const unsigned int idle_rate)
+
+	: active_period_(std::chrono::duration_cast<Duration>(
+		std::chrono::duration<double>(1.0 / active_rate)))
+	, idle_period_(std::chrono::duration_cast<Duration>(
+		std::chrono::duration<double>(1.0 / idle_rate)))
+{
+	BOOST_ASSERT(active_rate > 0);
+	BOOST_ASSERT(idle_rate > 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+PaceMode
+FramePacer::select(const bool paused, const bool animating)
+const noexcept
+{
+	return paused 
+		? PaceMode::Paused 
+		: animating 
+			? PaceMode::Active 
+			: PaceMode::Idle;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+Duration
+FramePacer::period(const PaceMode mode)
+const noexcept
+{
+	BOOST_ASSERT(mode != PaceMode::Paused);
+	return mode == PaceMode::Active ? active_period_ : idle_period_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+FramePacer::account(const PaceMode mode, const Duration wall, const Duration cpu)
+noexcept
+{
+	auto& usage = usage_[static_cast<std::size_t>(mode)];
+	usage.wall_ += wall;
+	usage.cpu_ += cpu;
+	++usage.frames_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+FramePacer::report(std::ostream& os)
+const
+{
+	using ms = std::chrono::duration<double, std::milli>;
+	using s = std::chrono::duration<double>;
+
+	constexpr const char* names[] = { "active", "idle", "paused" };
+
+	for (std::size_t i = 0; i < usage_.size(); ++i) {
+		const auto& usage = usage_[i];
+		const auto wall = s(usage.wall_).count();
+
+		os << names[i] << ": " 
+			<< usage.frames_ << " frames over " << wall << " s, "
+			<< "CPU " << (wall > 0 ? ms(usage.cpu_).count() / wall : 0.0) 
+			<< " ms/s" << std::endl;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <ostream>
+
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief How fast the game loop should run.
+ ***/
+enum class PaceMode {
+	Active, ///< Something is moving. Run at the display's refresh rate.
+	Idle,   ///< Nothing changes on screen. Run at a low rate.
+	Paused, ///< The game is paused. Sleep until the next event.
+
+	count
+};
+
+/***
+ * @brief Policy deciding how fast the game loop runs, and bookkeeping of how 
+ * much CPU each pace costs.
+ * 
+ * The loop asks for a mode at the end of every frame, waits according to it, 
+ * and reports back how much wall and CPU time the frame took in that mode.
+ ***/
+class FramePacer
+{
+public:
+	/***
+	 * @brief Construct the pacer.
+	 * 
+	 * @param active_rate - Frames per second while something is moving. 
+	 *                      Should match the display's refresh rate.
+	 * @param idle_rate   - Frames per second while the screen is static.
+	 ***/
+	FramePacer(
+		const unsigned int active_rate = 60, 
+		const unsigned int idle_rate = 10);
+
+	/***
+	 * @brief Pick the mode for the next frame.
+	 * 
+	 * @param paused      - Whether the game is paused.
+	 * @param animating   - Whether anything on screen is changing, or inputs 
+	 *                      are waiting to be simulated.
+	 * 
+	 * @return Mode to run the next frame in.
+	 ***/
+	PaceMode
+	select(const bool paused, const bool animating)
+	const noexcept;
+
+	/***
+	 * @brief Get how long a frame should last in a mode.
+	 * 
+	 * @param mode        - Pace mode other than @enum PaceMode::Paused, which 
+	 *                      has no set length.
+	 * 
+	 * @return Target frame length.
+	 ***/
+	Duration
+	period(const PaceMode mode)
+	const noexcept;
+
+	/***
+	 * @brief Account for a frame.
+	 * 
+	 * @param mode        - Mode the frame ran in.
+	 * @param wall        - Real time the frame took, including waiting.
+	 * @param cpu         - CPU time the process used during the frame.
+	 ***/
+	void
+	account(const PaceMode mode, const Duration wall, const Duration cpu)
+	noexcept;
+
+	/***
+	 * @brief Print the time spent in each mode and the CPU time used per 
+	 * second in it.
+	 * 
+	 * @param os          - Stream to print to.
+	 ***/
+	void
+	report(std::ostream& os)
+	const;
+
+private:
+	/***
+	 * @brief Time spent in a mode.
+	 ***/
+	struct Usage
+	{
+		Duration    wall_ = Duration::zero(); ///< Real time.
+		Duration    cpu_  = Duration::zero(); ///< CPU time.
+		std::size_t frames_ = 0;              ///< Frames.
+	};
+
+	/***
+	 * @brief Private attributes.
+	 ***/
+	Duration active_period_; ///< Frame length while active.
+	Duration idle_period_;   ///< Frame length while idle.
+	std::array<Usage, static_cast<std::size_t>(PaceMode::count)> usage_; 
+	///< Time spent in each mode.
+};
+
+}
@@ -0,0 +1,455 @@
+#include <algorithm>
+#include <optional>
+#include <boost/assert.hpp>
+#include <SFML/System/Sleep.hpp>
+#include <SFML/Window/Event.hpp>
+
+#include "GameLoop.hpp"
+#include "render/RenderThread.hpp"
+#include "utility/CpuTime.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	// If a frame takes longer than this (e.g. the window is being dragged), the 
+	// simulation skips ahead instead of trying to catch up with a long series 
+	// of steps, which would only make the next frame even longer.
+	constexpr auto max_frame_time = std::chrono::milliseconds(250);
+
+	// While waiting for the next frame, check for events this often.
+	constexpr auto poll_interval = std::chrono::milliseconds(2);
+
+	// Holding a direction moves again after this long, then at this interval.
+	constexpr auto repeat_delay = std::chrono::milliseconds(400);
+	constexpr auto repeat_interval = std::chrono::milliseconds(100);
+
+	constexpr KeyAction repeated[] = {
+		KeyAction::Up, KeyAction::Down, KeyAction::Left, KeyAction::Right,
+	};
+
+	void
+	print(std::ostream& os, const char* what, const TimeStats& stats)
+	{
+		using ms = std::chrono::duration<double, std::milli>;
+
+		os << what << ": "
+			<< stats.count_ << " samples, "
+			<< "mean " << ms(stats.mean()).count() << " ms, "
+			<< "max " << ms(stats.max_).count() << " ms" << std::endl;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+GameLoop::GameLoop(
+	Game& game,
+	const KeyControls& controls,
+	const bool threaded,
+	const Duration step)
+
+	: game_       (game)
+	, controls_   (controls)
+	, threaded_   (threaded)
+	, quit_       (false)
+	, step_       (step)
+	, tick_       (0)
+	, recorder_   (nullptr)
+	, replay_     (nullptr)
+	, pacer_      (nullptr)
+	, capture_    (nullptr)
+	, accumulator_(Duration::zero())
+	, run_time_   (Duration::zero())
+{
+	BOOST_ASSERT(step > Duration::zero());
+
+	for (const auto action : repeated) {
+		repeatKey(action, repeat_delay, repeat_interval);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+GameLoop&
+GameLoop::recordTo(InputRecorder& recorder)
+noexcept
+{
+	recorder_ = &recorder;
+	return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+GameLoop&
+GameLoop::replayFrom(InputReplay& replay)
+noexcept
+{
+	replay_ = &replay;
+	return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+GameLoop&
+GameLoop::paceFrames(FramePacer& pacer)
+noexcept
+{
+	pacer_ = &pacer;
+	return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+GameLoop&
+GameLoop::captureFrom(InputCapture& capture)
+noexcept
+{
+	capture_ = &capture;
+	return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+GameLoop&
+GameLoop::repeatKey(
+	const KeyAction action, 
+	const Duration delay, 
+	const Duration interval)
+noexcept
+{
+	// Rounded up to whole steps, at least one.
+	const auto steps = [this](const Duration d) {
+		const auto n = (d + step_ - Duration(1)) / step_;
+		return std::uint32_t(std::max<Duration::rep>(1, n));
+	};
+
+	actions_.setRepeat(
+		action, 
+		steps(delay), 
+		interval > Duration::zero() ? steps(interval) : 0
+	);
+	return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+GameLoop::run(RenderBackend& backend)
+{
+	const auto run_start = SteadyClock::now();
+	last_frame_ = run_start;
+	sim_time_ = last_frame_;
+
+	auto cpu_start = processCpuTime();
+
+	std::optional<RenderThread> renderer;
+	if (threaded_) {
+		renderer.emplace(backend, frames_);
+	}
+
+	while (!quit_) {
+		const auto frame_start = SteadyClock::now();
+		pumpEvents(backend);
+
+		// Fraction of a step that has passed since the last simulated state.
+		auto alpha = 1.f;
+
+		if (replay_ != nullptr) {
+			step();
+			quit_ = quit_ || replay_->finished();
+		}
+		else {
+			simulate(SteadyClock::now());
+			alpha = std::chrono::duration<float>(accumulator_) 
+				/ std::chrono::duration<float>(step_);
+		}
+
+		auto& frame = frames_.back();
+		frame.clear();
+		game_.draw(frame, alpha);
+
+		const auto sim_end = SteadyClock::now();
+		sim_timing_.record(sim_end - frame_start);
+
+		if (renderer) {
+			// The render thread takes it from here.
+			frames_.publish();
+		}
+		else {
+			backend.clear(sf::Color::White);
+			frame.submit(backend);
+			backend.display();
+			render_timing_.record(SteadyClock::now() - sim_end);
+		}
+
+		frame_timing_.record(SteadyClock::now() - frame_start);
+
+		if (pacer_ != nullptr) {
+			const auto mode = pacer_->select(
+				game_.paused(), 
+				game_.animating() || !inputs_.empty() || actions_.anyHeld());
+			pace(backend, mode, frame_start);
+
+			const auto cpu_end = processCpuTime();
+			pacer_->account(mode, SteadyClock::now() - frame_start, cpu_end - cpu_start);
+			cpu_start = cpu_end;
+		}
+	}
+
+	// The render thread must let go of the backend before it can be closed.
+	if (renderer) {
+		renderer->stop();
+		render_timing_ = renderer->timing();
+	}
+
+	backend.close();
+	run_time_ = SteadyClock::now() - run_start;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+const TimeStats&
+GameLoop::latency()
+const noexcept
+{
+	return latency_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+GameLoop::report(std::ostream& os)
+const
+{
+	// With threaded rendering, a frame should take about as long as the 
+	// slower of simulating and rendering instead of the sum of both.
+	print(os, "input-to-update latency", latency_);
+	latency_histogram_.print(os, "input-to-update latency distribution");
+	print(os, "simulation per frame", sim_timing_);
+	print(os, threaded_ ? "render thread per frame" : "rendering per frame", 
+		render_timing_);
+	print(os, "frame", frame_timing_);
+
+	if (pacer_ != nullptr) {
+		pacer_->report(os);
+	}
+
+	using ms = std::chrono::duration<double, std::milli>;
+	os << "run: " 
+		<< tick_ << " steps in " << ms(run_time_).count() << " ms";
+	if (tick_ > 0) {
+		os << ", " << ms(run_time_).count() / double(tick_) << " ms/step";
+	}
+	os << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+GameLoop::pumpEvents(RenderBackend& backend)
+{
+	// Drain the whole event queue instead of taking one event per frame, so 
+	// that bursts of input don't queue up behind the frame rate.
+	for (sf::Event event; backend.pollEvent(event); ) {
+		handleEvent(event);
+	}
+
+	if (capture_ != nullptr) {
+		for (CapturedKey key; capture_->pop(key); ) {
+			handleKey(key.key_, key.modifiers_, key.released_, key.stamp_);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+GameLoop::handleEvent(const sf::Event& event)
+{
+	switch (event.type) {
+		case sf::Event::Closed:
+			quit_ = true;
+		break;
+
+		case sf::Event::LostFocus: {
+			// The recording holds no pauses, so a replay plays on regardless.
+			if (replay_ != nullptr) {
+				break;
+			}
+
+			game_.pause();
+			if (capture_ != nullptr) {
+				capture_->setFocused(false);
+			}
+
+			// The keys held now will go up unseen.
+			std::vector<KeyAction> released;
+			keyboard_.releaseAll(released);
+			for (const auto action : released) {
+				inputs_.push(action, SteadyClock::now(), true);
+			}
+		}
+		break;
+
+		case sf::Event::GainedFocus:
+			if (replay_ != nullptr) {
+				break;
+			}
+
+			game_.resume();
+			if (capture_ != nullptr) {
+				capture_->setFocused(true);
+			}
+		break;
+
+		case sf::Event::KeyPressed:
+		case sf::Event::KeyReleased:
+			// With a capture thread, keys come from it instead.
+			if (capture_ == nullptr) {
+				handleKey(
+					Key(event.key.code), 
+					modifiers(event.key), 
+					event.type == sf::Event::KeyReleased, 
+					SteadyClock::now());
+			}
+		break;
+
+		default:
+		break;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+GameLoop::handleKey(
+	const Key& k, 
+	const std::uint8_t modifiers, 
+	const bool released, 
+	const TimePoint stamp)
+{
+	if (replay_ != nullptr) {
+		// Only the recording gets to play.
+		return;
+	}
+
+	if (released) {
+		if (const auto action = keyboard_.release(k)) {
+			inputs_.push(*action, stamp, true);
+		}
+	}
+	else {
+		const auto action = keyboard_.press(k, controls_.convert(k, modifiers));
+		if (action) {
+			inputs_.push(*action, stamp);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+GameLoop::pace(RenderBackend& backend, const PaceMode mode, const TimePoint frame_start)
+{
+	if (mode == PaceMode::Paused) {
+		// Nothing happens until the platform says so, e.g. the window gets 
+		// the focus back.
+		if (sf::Event event; backend.waitEvent(event)) {
+			handleEvent(event);
+		}
+
+		// The simulation shouldn't catch up on the time spent asleep.
+		last_frame_ = SteadyClock::now();
+		return;
+	}
+
+	// Keep taking events while waiting. Inputs get a more accurate timestamp 
+	// that way, and an idle loop can start the next frame right away.
+	const auto deadline = frame_start + pacer_->period(mode);
+
+	for (auto now = SteadyClock::now(); now < deadline && !quit_; now = SteadyClock::now()) {
+		pumpEvents(backend);
+
+		if (mode == PaceMode::Idle && !inputs_.empty()) {
+			break;
+		}
+
+		const auto nap = std::min<Duration>(deadline - now, poll_interval);
+		sf::sleep(sf::microseconds(
+			std::chrono::duration_cast<std::chrono::microseconds>(nap).count()));
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+GameLoop::simulate(const TimePoint now)
+{
+	accumulator_ += std::min<Duration>(now - last_frame_, max_frame_time);
+	last_frame_ = now;
+
+	// Keep the simulated time in step with the wall clock, even if some of it 
+	// was just dropped.
+	sim_time_ = now - accumulator_;
+
+	while (accumulator_ >= step_) {
+		accumulator_ -= step_;
+		sim_time_ += step_;
+		step();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+GameLoop::step()
+{
+	// Hand over the inputs that are due by the end of this step.
+	batch_.clear();
+	const auto update_start = SteadyClock::now();
+
+	if (replay_ != nullptr) {
+		replay_->popTick(tick_, update_start, batch_);
+	}
+	else {
+		inputs_.popUntil(sim_time_, batch_);
+	}
+
+	for (const auto& input : batch_) {
+		latency_.record(update_start - input.stamp_);
+		latency_histogram_.record(update_start - input.stamp_);
+
+		if (recorder_ != nullptr) {
+			recorder_->record(tick_, input.action_, input.released_);
+		}
+	}
+
+	// Repeats aren't recorded; the replay makes the same ones.
+	presses_.clear();
+	actions_.update(batch_, update_start, presses_);
+	game_.update(presses_, actions_);
+	++tick_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "Game.hpp"
+#include "key/ActionState.hpp"
+#include "key/KeyControls.hpp"
+#include "key/KeyboardState.hpp"
+#include "loop/FramePacer.hpp"
+#include "loop/InputCapture.hpp"
+#include "loop/InputQueue.hpp"
+#include "loop/InputRecorder.hpp"
+#include "loop/InputReplay.hpp"
+#include "render/RenderBackend.hpp"
+#include "render/RenderBuffer.hpp"
+#include "utility/TimeHistogram.hpp"
+#include "utility/TimeStats.hpp"
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Main loop of the game.
+ * 
+ * Each frame, every pending platform event is drained into a timestamped input 
+ * queue. The simulation then advances in fixed steps, independently of the 
+ * frame rate, by accumulating the real time that has passed and running as 
+ * many steps as fit into it. Whatever is left over is handed to the renderer 
+ * as an interpolation factor between the last two simulated states.
+ * 
+ * The game records each frame into a render list. The list is either 
+ * submitted right away, or, with threaded rendering, handed to a render thread 
+ * so that the next frame can be simulated in the meantime.
+ * 
+ * Keys going down and up are tracked by the loop itself rather than relying on 
+ * the platform's key repeat. Each step turns the presses and releases due into 
+ * the state of every control, and repeats held controls on the simulation 
+ * clock. By default the directions repeat, so that holding one keeps moving 
+ * through a menu.
+ * 
+ * Optionally, keys are captured on a dedicated thread instead, which stamps 
+ * them closer to when they were pressed. Inputs are applied at the step that 
+ * covers their stamp, so a press in the middle of a long frame still lands 
+ * in the right step.
+ * 
+ * Inputs can be recorded to a file as they are consumed. When replaying such 
+ * a file instead, key presses and focus changes from the backend are ignored 
+ * and the loop runs exactly one step per frame, so that a replay simulates 
+ * the same steps with the same inputs no matter how fast the machine is. The 
+ * loop quits once the recording runs out.
+ * 
+ * Without a frame pacer, frames run back to back as fast as the backend 
+ * allows. With one, the loop waits at the end of each frame, slowing down when 
+ * nothing on screen changes and sleeping until the next event while the game 
+ * is paused. Events are still taken while waiting, so input wakes it up.
+ ***/
+class GameLoop
+{
+public:
+	/***
+	 * @brief Construct the game loop.
+	 * 
+	 * @param game        - Game to simulate and draw.
+	 * @param controls    - Key configurations to translate key presses with.
+	 * @param threaded    - Whether to render on a dedicated thread.
+	 * @param step        - Simulated time per call to @property Game::update.
+	 ***/
+	GameLoop(
+		Game& game,
+		const KeyControls& controls,
+		const bool threaded = false,
+		const Duration step = std::chrono::microseconds(16667));
+
+	/***
+	 * @brief Write every consumed input to a recording.
+	 * 
+	 * @param recorder    - Recording to write to. Must outlive the loop.
+	 * 
+	 * @return The game loop itself.
+	 ***/
+	GameLoop&
+	recordTo(InputRecorder& recorder)
+	noexcept;
+
+	/***
+	 * @brief Take inputs from a recording instead of the backend.
+	 * 
+	 * @param replay      - Recording to play back. Must outlive the loop.
+	 * 
+	 * @return The game loop itself.
+	 ***/
+	GameLoop&
+	replayFrom(InputReplay& replay)
+	noexcept;
+
+	/***
+	 * @brief Pace frames according to a policy instead of running them back to 
+	 * back.
+	 * 
+	 * @param pacer       - Pacing policy. Must outlive the loop.
+	 * 
+	 * @return The game loop itself.
+	 ***/
+	GameLoop&
+	paceFrames(FramePacer& pacer)
+	noexcept;
+
+	/***
+	 * @brief Take key presses from a capture thread instead of the backend's 
+	 * key events.
+	 * 
+	 * @param capture     - Capture to take keys from. Must outlive the loop.
+	 * 
+	 * @return The game loop itself.
+	 ***/
+	GameLoop&
+	captureFrom(InputCapture& capture)
+	noexcept;
+
+	/***
+	 * @brief Set how a control repeats while held.
+	 * 
+	 * @param action      - Control.
+	 * @param delay       - Time between the press and the first repeat.
+	 * @param interval    - Time between repeats, zero for no repeat.
+	 * 
+	 * @return The game loop itself.
+	 ***/
+	GameLoop&
+	repeatKey(
+		const KeyAction action, 
+		const Duration delay, 
+		const Duration interval)
+	noexcept;
+
+	/***
+	 * @brief Run the game until the backend sends a close event, then close 
+	 * the backend.
+	 * 
+	 * @param backend     - Where to draw and take events from.
+	 ***/
+	void
+	run(RenderBackend& backend);
+
+	/***
+	 * @brief Get the input-to-update latency measured so far.
+	 * 
+	 * @return Latency statistics.
+	 ***/
+	const TimeStats&
+	latency()
+	const noexcept;
+
+	/***
+	 * @brief Print a summary of the measured latency and frame timing.
+	 * 
+	 * @param os          - Stream to print to.
+	 ***/
+	void
+	report(std::ostream& os)
+	const;
+
+private:
+	/***
+	 * @brief Handle every event currently pending in the backend.
+	 * 
+	 * @param backend     - Where to take events from.
+	 ***/
+	void
+	pumpEvents(RenderBackend& backend);
+
+	/***
+	 * @brief Handle a platform event.
+	 * 
+	 * @param event       - Event to handle.
+	 ***/
+	void
+	handleEvent(const sf::Event& event);
+
+	/***
+	 * @brief Turn a key going down or up into an input, if it's bound.
+	 * 
+	 * @param k           - Key.
+	 * @param modifiers   - Modifiers held, @enum Modifier bits.
+	 * @param released    - Whether the key went up instead of down.
+	 * @param stamp       - When it happened.
+	 ***/
+	void
+	handleKey(
+		const Key& k, 
+		const std::uint8_t modifiers, 
+		const bool released, 
+		const TimePoint stamp);
+
+	/***
+	 * @brief Wait at the end of a frame, as the pacer decides.
+	 * 
+	 * @param backend     - Where to take events from while waiting.
+	 * @param mode        - Pace of the frame.
+	 * @param frame_start - Start of the frame.
+	 ***/
+	void
+	pace(RenderBackend& backend, const PaceMode mode, const TimePoint frame_start);
+
+	/***
+	 * @brief Run as many fixed simulation steps as the elapsed time allows.
+	 * 
+	 * @param now         - Start of the current frame.
+	 ***/
+	void
+	simulate(const TimePoint now);
+
+	/***
+	 * @brief Run one simulation step with the inputs due for it.
+	 ***/
+	void
+	step();
+
+	/***
+	 * @brief Private attributes.
+	 ***/
+	Game&              game_;        ///< Game to simulate and draw.
+	const KeyControls& controls_;    ///< Key to control translation.
+	bool               threaded_;    ///< Render on a dedicated thread.
+	bool               quit_;        ///< The backend asked to quit.
+	Duration           step_;        ///< Fixed simulation step.
+	std::uint64_t      tick_;        ///< Simulation steps run so far.
+	InputRecorder*     recorder_;    ///< Where to record inputs, if anywhere.
+	InputReplay*       replay_;      ///< Where to replay inputs from, if anywhere.
+	FramePacer*        pacer_;       ///< Frame pacing policy, if any.
+	InputCapture*      capture_;     ///< Where to take keys from, if not events.
+	Duration           accumulator_; ///< Real time not yet simulated.
+	TimePoint          last_frame_;  ///< Start of the previous frame.
+	TimePoint          sim_time_;    ///< Real time the simulation has reached.
+	InputQueue         inputs_;      ///< Inputs not yet simulated.
+	KeyboardState      keyboard_;    ///< Keys down, from the events.
+	ActionState        actions_;     ///< Controls held, at the current step.
+	std::vector<TimedInput> batch_;  ///< Inputs due for the current step.
+	std::vector<TimedInput> presses_; ///< Presses and repeats of the step.
+	RenderBuffer       frames_;      ///< Recorded frames.
+	TimeStats          latency_;     ///< Input-to-update latency.
+	TimeHistogram      latency_histogram_; ///< Its distribution.
+	TimeStats          sim_timing_;  ///< Simulating and recording a frame.
+	TimeStats          render_timing_; ///< Submitting and displaying a frame.
+	TimeStats          frame_timing_;  ///< Whole frame on the main thread.
+	Duration           run_time_;    ///< Wall time of the whole run.
+};
+
+}
@@ -0,0 +1,206 @@
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <mmsystem.h>
+#endif
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+#include <SFML/Window/Keyboard.hpp>
+
+#include "InputCapture.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	constexpr auto idle_after = std::chrono::seconds(1);
+	constexpr auto idle_period = std::chrono::milliseconds(4);
+
+	constexpr std::pair<sf::Keyboard::Key, Modifier> modifier_keys[] = {
+		{ sf::Keyboard::LShift,   Modifier::Shift   },
+		{ sf::Keyboard::RShift,   Modifier::Shift   },
+		{ sf::Keyboard::LControl, Modifier::Control },
+		{ sf::Keyboard::RControl, Modifier::Control },
+		{ sf::Keyboard::LAlt,     Modifier::Alt     },
+		{ sf::Keyboard::RAlt,     Modifier::Alt     },
+		{ sf::Keyboard::LSystem,  Modifier::System  },
+		{ sf::Keyboard::RSystem,  Modifier::System  },
+	};
+
+	std::uint8_t
+	heldModifiers()
+	{
+		auto modifiers = std::uint8_t(0);
+		for (const auto& [key, modifier] : modifier_keys) {
+			if (sf::Keyboard::isKeyPressed(key)) {
+				modifiers |= std::uint8_t(modifier);
+			}
+		}
+
+		return modifiers;
+	}
+
+	/***
+	 * @brief Raises the system timer's resolution to 1 ms while it lives, 
+	 * where sleeps are otherwise much coarser.
+	 ***/
+	struct TimerResolution
+	{
+#ifdef _WIN32
+		TimerResolution() { timeBeginPeriod(1); }
+		~TimerResolution() { timeEndPeriod(1); }
+#endif
+	};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+InputCapture::InputCapture(const ActionMap& map, const Duration period)
+	: period_ (period)
+	, focused_(true)
+	, stop_   (false)
+	, dropped_(0)
+{
+	for (std::size_t c = 0; c < std::size_t(InputContext::count); ++c) {
+		for (std::size_t a = 0; a < std::size_t(KeyAction::count); ++a) {
+			const auto& chords = map.bindings(InputContext(c), KeyAction(a));
+			for (const auto& chord : chords) {
+				if (chord.key_ != Key(sf::Keyboard::Unknown) 
+					&& std::find(keys_.cbegin(), keys_.cend(), chord.key_) 
+						== keys_.cend()) {
+					keys_.push_back(chord.key_);
+				}
+			}
+		}
+	}
+
+	thread_ = std::thread([this]() { run(); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+InputCapture::~InputCapture()
+{
+	{
+		const std::lock_guard lock(mutex_);
+		stop_.store(true, std::memory_order_relaxed);
+	}
+
+	wake_.notify_one();
+	thread_.join();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+InputCapture::setFocused(const bool focused)
+noexcept
+{
+	{
+		const std::lock_guard lock(mutex_);
+		focused_.store(focused, std::memory_order_relaxed);
+	}
+
+	wake_.notify_one();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+InputCapture::pop(CapturedKey& key)
+noexcept
+{
+	return ring_.pop(key);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+InputCapture::dropped()
+const noexcept
+{
+	return dropped_.load(std::memory_order_relaxed);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+InputCapture::run()
+{
+	[[maybe_unused]] const TimerResolution resolution;
+	std::vector<bool> down(keys_.size(), false);
+	auto next = SteadyClock::now();
+	auto last_active = next;
+
+	while (!stop_.load(std::memory_order_relaxed)) {
+		if (!focused_.load(std::memory_order_relaxed)) {
+			// The main loop lets go of every key when the focus is lost. Keys 
+			// still down when it comes back count as new presses.
+			std::fill(down.begin(), down.end(), false);
+
+			std::unique_lock lock(mutex_);
+			wake_.wait(lock, [this]() {
+				return focused_.load(std::memory_order_relaxed) 
+					|| stop_.load(std::memory_order_relaxed);
+			});
+
+			next = SteadyClock::now();
+			last_active = next;
+			continue;
+		}
+
+		const auto now = SteadyClock::now();
+		auto modifiers = std::optional<std::uint8_t>();
+		auto active = false;
+
+		for (std::size_t i = 0; i < keys_.size(); ++i) {
+			const auto key = sf::Keyboard::Key(keys_[i]);
+			const auto pressed = sf::Keyboard::isKeyPressed(key);
+			active = active || pressed || down[i];
+			if (pressed == down[i]) {
+				continue;
+			}
+
+			if (!modifiers) {
+				modifiers = heldModifiers();
+			}
+
+			// If the ring is full, the change is seen again next time.
+			if (ring_.push({ keys_[i], *modifiers, !pressed, now })) {
+				down[i] = pressed;
+			}
+			else {
+				dropped_.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		if (active) {
+			last_active = now;
+		}
+
+		// Sample less often while nothing is happening.
+		const auto period = now - last_active < idle_after 
+			? period_ 
+			: std::max(period_, Duration(idle_period));
+
+		// Keep a steady rate, without trying to catch up after a long sleep.
+		next = std::max(next + period, SteadyClock::now());
+		std::this_thread::sleep_until(next);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
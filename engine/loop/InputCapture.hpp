@@ -0,0 +1,125 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "key/ActionMap.hpp"
+#include "utility/SpscRing.hpp"
+#include "utility/type/Key.hpp"
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Key going down or up, stamped when it was seen.
+ ***/
+struct CapturedKey
+{
+	Key           key_;       ///< Key.
+	std::uint8_t  modifiers_; ///< Modifiers held, @enum Modifier bits.
+	bool          released_;  ///< The key went up, not down.
+	TimePoint     stamp_;     ///< When the change was seen.
+};
+
+/***
+ * @brief Watches the keyboard on a dedicated thread, so that key presses are 
+ * stamped when they happen instead of when the main loop polls its events.
+ * 
+ * Window events can only be taken on the thread that created the window, so 
+ * the capture thread samples the real-time state of the keys bound to a 
+ * control instead, about once per period, and passes every change to the 
+ * main loop through a lock-free single-producer, single-consumer ring. A 
+ * stamp is at most a period late, whatever the frame time.
+ * 
+ * The period can't be finer than the system's sleep. Windows rounds sleeps up 
+ * to its timer tick, about 15.6 ms by default, so the capture raises the timer 
+ * to 1 ms for as long as it runs; other systems sleep to well under a 
+ * millisecond already.
+ * 
+ * The keys to watch are read from the bindings once, when the capture starts. 
+ * Nothing is captured while the window doesn't have the focus, and the thread 
+ * sleeps until it comes back. After a second with no key down, the keyboard 
+ * is only sampled every 4 ms, which delays the stamp of the first press by at 
+ * most that much.
+ ***/
+class InputCapture
+{
+public:
+	/***
+	 * @brief Start capturing.
+	 * 
+	 * @param map         - Bindings of every context, for the keys to watch.
+	 * @param period      - Time between two samples of the keyboard.
+	 ***/
+	explicit
+	InputCapture(
+		const ActionMap& map, 
+		const Duration period = std::chrono::milliseconds(1));
+
+	/***
+	 * @brief Stop the capture thread.
+	 ***/
+	~InputCapture();
+
+	InputCapture(const InputCapture&) = delete;
+	InputCapture& operator=(const InputCapture&) = delete;
+
+	/***
+	 * @brief Tell the capture whether the window has the focus. Only changes 
+	 * that happen with the focus are captured.
+	 * 
+	 * @param focused     - Whether the window has the focus.
+	 ***/
+	void
+	setFocused(const bool focused)
+	noexcept;
+
+	/***
+	 * @brief Take the oldest captured change. Only one thread may call this.
+	 * 
+	 * @param key         - Where to put the change.
+	 * 
+	 * @return True if there was one, false otherwise.
+	 ***/
+	bool
+	pop(CapturedKey& key)
+	noexcept;
+
+	/***
+	 * @brief Get the number of times a change didn't fit in the ring and had 
+	 * to wait for the next sample.
+	 * 
+	 * @return Delayed changes.
+	 ***/
+	std::size_t
+	dropped()
+	const noexcept;
+
+private:
+	/***
+	 * @brief Body of the capture thread.
+	 ***/
+	void
+	run();
+
+	/***
+	 * @brief Private attributes.
+	 ***/
+	std::vector<Key>             keys_;    ///< Keys to watch.
+	Duration                     period_;  ///< Time between samples.
+	SpscRing<CapturedKey, 256>   ring_;    ///< Changes not yet taken.
+	std::atomic<bool>            focused_; ///< The window has the focus.
+	std::atomic<bool>            stop_;    ///< The thread must end.
+	std::mutex                   mutex_;   ///< Guards changes to the flags.
+	std::condition_variable      wake_;    ///< Signals a change to the flags.
+	std::atomic<std::size_t>     dropped_; ///< Changes delayed by a full ring.
+	std::thread                  thread_;  ///< Samples the keyboard.
+};
+
+}
@@ -0,0 +1,54 @@
+#include <iterator>
+
+#include "InputQueue.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+InputQueue::push(
+	const KeyAction action, 
+	const TimePoint stamp, 
+	const bool released)
+{
+	// Inputs mostly arrive in order. A captured key can be older than an 
+	// input pushed before it, so it goes back to its place.
+	auto it = queue_.end();
+	while (it != queue_.begin() && std::prev(it)->stamp_ > stamp) {
+		--it;
+	}
+
+	queue_.insert(it, { action, stamp, released });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+InputQueue::popUntil(const TimePoint until, std::vector<TimedInput>& batch)
+{
+	// Inputs are pushed in the order they are received, so the due ones are 
+	// all at the front.
+	while (!queue_.empty() && queue_.front().stamp_ <= until) {
+		batch.push_back(queue_.front());
+		queue_.pop_front();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+InputQueue::empty()
+const noexcept
+{
+	return queue_.empty();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <deque>
+#include <vector>
+
+#include "utility/type/Key.hpp"
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Player input tagged with the time it was received.
+ ***/
+struct TimedInput
+{
+	KeyAction action_;           ///< Control the player triggered.
+	TimePoint stamp_;            ///< When the event was pulled from the backend.
+	bool      released_ = false; ///< The control was let go, not pressed.
+};
+
+/***
+ * @brief FIFO of player inputs waiting to be consumed by the simulation.
+ * 
+ * The backend's event queue is drained completely every frame into this queue,
+ * so a burst of key presses never piles up behind the frame rate. The 
+ * simulation then takes the inputs that are due at each fixed step.
+ ***/
+class InputQueue
+{
+public:
+	/***
+	 * @brief Queue an input, after the ones received at or before it.
+	 * 
+	 * @param action      - Control the player triggered.
+	 * @param stamp       - When the input was received.
+	 * @param released    - Whether the control was let go instead of pressed.
+	 ***/
+	void
+	push(
+		const KeyAction action, 
+		const TimePoint stamp, 
+		const bool released = false);
+
+	/***
+	 * @brief Move every input received at or before a point in time into a 
+	 * batch, oldest first.
+	 * 
+	 * @param until       - Latest timestamp to take.
+	 * @param batch       - Container to append the inputs to. It is not 
+	 *                      cleared beforehand.
+	 ***/
+	void
+	popUntil(const TimePoint until, std::vector<TimedInput>& batch);
+
+	/***
+	 * @brief Indicates whether there are inputs waiting.
+	 * 
+	 * @return True if yes, false otherwise.
+	 ***/
+	bool
+	empty()
+	const noexcept;
+
+private:
+	std::deque<TimedInput> queue_; ///< Pending inputs, oldest at the front.
+};
+
+}
@@ -0,0 +1,71 @@
+#include <boost/assert.hpp>
+
+#include "InputRecorder.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	constexpr char magic[] = { 'N', 'R', 'E', 'C' };
+	constexpr char version = 2;
+	constexpr char released_bit = static_cast<char>(0x80);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+InputRecorder::InputRecorder(const std::string& file)
+	: ofs_      (file, std::ios::binary | std::ios::trunc)
+	, last_tick_(0)
+	, count_    (0)
+{
+	BOOST_ASSERT(ofs_);
+	ofs_.write(magic, sizeof(magic));
+	ofs_.put(version);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+InputRecorder::record(
+	const std::uint64_t tick, 
+	const KeyAction action, 
+	const bool released)
+{
+	BOOST_ASSERT(tick >= last_tick_);
+
+	// LEB128: 7 bits per byte, lowest first, high bit set on all but the last.
+	auto delta = tick - last_tick_;
+	do {
+		auto byte = static_cast<char>(delta & 0x7f);
+		delta >>= 7;
+		if (delta != 0) {
+			byte |= static_cast<char>(0x80);
+		}
+		ofs_.put(byte);
+	} while (delta != 0);
+
+	ofs_.put(static_cast<char>(action) | (released ? released_bit : 0));
+
+	last_tick_ = tick;
+	++count_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::uint64_t
+InputRecorder::count()
+const noexcept
+{
+	return count_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
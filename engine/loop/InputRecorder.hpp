@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#include "utility/type/Key.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Writes every input the simulation consumes to a file, so that the 
+ * same session can be replayed later by @class InputReplay.
+ * 
+ * The file starts with the 4-byte magic "NREC" and a version byte. Each input 
+ * follows as the number of simulation steps since the previous input, written 
+ * as an unsigned LEB128 varint, and the @enum KeyAction as one byte, with the 
+ * high bit set if the control was let go. Inputs in the same step have a delta 
+ * of 0. A typical input takes 2 bytes.
+ * 
+ * Version 1 recordings have no releases; each press is let go in the step it 
+ * happened in.
+ ***/
+class InputRecorder
+{
+public:
+	/***
+	 * @brief Create or overwrite a recording.
+	 * 
+	 * This constructor generates an assertion error if the file can't be 
+	 * opened for writing.
+	 * 
+	 * @param file        - Path to the recording.
+	 ***/
+	explicit InputRecorder(const std::string& file);
+
+	/***
+	 * @brief Write an input.
+	 * 
+	 * @param tick        - Simulation step the input was consumed in. Must not 
+	 *                      be lower than that of the previous input.
+	 * @param action      - Control the player triggered.
+	 * @param released    - Whether the control was let go instead of pressed.
+	 ***/
+	void
+	record(
+		const std::uint64_t tick, 
+		const KeyAction action, 
+		const bool released = false);
+
+	/***
+	 * @brief Get the number of inputs written so far.
+	 * 
+	 * @return Input count.
+	 ***/
+	std::uint64_t
+	count()
+	const noexcept;
+
+private:
+	std::ofstream ofs_;       ///< Recording.
+	std::uint64_t last_tick_; ///< Step of the previous input.
+	std::uint64_t count_;     ///< Inputs written.
+};
+
+}
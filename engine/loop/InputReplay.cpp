@@ -0,0 +1,146 @@
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+#include "InputReplay.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	constexpr char magic[] = { 'N', 'R', 'E', 'C' };
+	constexpr char version = 2;
+	constexpr std::uint8_t released_bit = 0x80;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+InputReplay::InputReplay()
+	: next_(0)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+InputReplay::load(const std::string& file, std::ostream& log)
+{
+	entries_.clear();
+	next_ = 0;
+
+	std::ifstream ifs(file, std::ios::binary);
+	if (!ifs) {
+		log << "cannot read " << file << std::endl;
+		return false;
+	}
+
+	const std::vector<char> bytes(
+		(std::istreambuf_iterator<char>(ifs)), 
+		std::istreambuf_iterator<char>());
+
+	if (bytes.size() <= sizeof(magic) 
+		|| !std::equal(std::begin(magic), std::end(magic), bytes.cbegin())) {
+		log << file << " is not a recording" << std::endl;
+		return false;
+	}
+
+	const auto file_version = bytes[sizeof(magic)];
+	if (file_version < 1 || file_version > version) {
+		log << file << " is a recording of unknown version " 
+			<< int(file_version) << std::endl;
+		return false;
+	}
+
+	const auto corrupt = [&]() {
+		log << file << " is truncated or corrupt" << std::endl;
+		entries_.clear();
+		return false;
+	};
+
+	auto tick = std::uint64_t(0);
+	auto i = sizeof(magic) + 1;
+
+	while (i < bytes.size()) {
+		// Step delta as a LEB128 varint.
+		auto delta = std::uint64_t(0);
+		auto shift = 0;
+		std::uint8_t byte;
+		do {
+			if (i == bytes.size() || shift >= 64) {
+				return corrupt();
+			}
+
+			byte = static_cast<std::uint8_t>(bytes[i++]);
+			delta |= std::uint64_t(byte & 0x7f) << shift;
+			shift += 7;
+		} while (byte & 0x80);
+
+		if (i == bytes.size()) {
+			return corrupt();
+		}
+
+		const auto code = static_cast<std::uint8_t>(bytes[i++]);
+		const auto action_code = std::uint8_t(code & ~released_bit);
+		if (action_code >= std::uint8_t(KeyAction::count)) {
+			return corrupt();
+		}
+
+		const auto action = static_cast<KeyAction>(action_code);
+		tick += delta;
+		entries_.push_back({ tick, action, (code & released_bit) != 0 });
+
+		if (file_version == 1) {
+			// Presses only; let go right away.
+			entries_.push_back({ tick, action, true });
+		}
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+InputReplay::popTick(
+	const std::uint64_t tick, 
+	const TimePoint stamp, 
+	std::vector<TimedInput>& batch)
+{
+	while (next_ < entries_.size() && entries_[next_].tick_ <= tick) {
+		batch.push_back(
+			{ entries_[next_].action_, stamp, entries_[next_].released_ }
+		);
+		++next_;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+InputReplay::finished()
+const noexcept
+{
+	return next_ == entries_.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+InputReplay::size()
+const noexcept
+{
+	return entries_.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "loop/InputQueue.hpp"
+#include "utility/type/Key.hpp"
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Plays back a recording made by @class InputRecorder.
+ * 
+ * The whole recording is loaded up front, so replaying doesn't touch the disk 
+ * while it is being timed.
+ ***/
+class InputReplay
+{
+public:
+	/***
+	 * @brief Construct an empty replay, to be filled by load().
+	 ***/
+	InputReplay();
+
+	/***
+	 * @brief Load a recording, replacing whatever was loaded before.
+	 * 
+	 * The file comes from the user, so a missing, truncated, or foreign file 
+	 * is reported rather than asserted against. Nothing is loaded then.
+	 * 
+	 * @param file        - Path to the recording.
+	 * @param log         - Stream to report errors to.
+	 * 
+	 * @return True if the recording was loaded, false otherwise.
+	 ***/
+	bool
+	load(const std::string& file, std::ostream& log);
+
+	/***
+	 * @brief Take the inputs recorded for a simulation step.
+	 * 
+	 * Steps are expected to be asked for in increasing order.
+	 * 
+	 * @param tick        - Simulation step.
+	 * @param stamp       - Timestamp to give the inputs.
+	 * @param batch       - Container to append the inputs to.
+	 ***/
+	void
+	popTick(
+		const std::uint64_t tick, 
+		const TimePoint stamp, 
+		std::vector<TimedInput>& batch);
+
+	/***
+	 * @brief Indicates whether every recorded input has been played back.
+	 * 
+	 * @return True if yes, false otherwise.
+	 ***/
+	bool
+	finished()
+	const noexcept;
+
+	/***
+	 * @brief Get the number of recorded inputs.
+	 * 
+	 * @return Input count.
+	 ***/
+	std::size_t
+	size()
+	const noexcept;
+
+private:
+	/***
+	 * @brief Recorded input.
+	 ***/
+	struct Entry
+	{
+		std::uint64_t tick_;     ///< Simulation step.
+		KeyAction     action_;   ///< Control the player triggered.
+		bool          released_; ///< The control was let go.
+	};
+
+	std::vector<Entry> entries_; ///< Recorded inputs in order.
+	std::size_t        next_;    ///< Next input to play back.
+};
+
+}
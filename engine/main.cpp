@@ -1,59 +1,123 @@
+#include <cstdlib>
+#include <iostream>
 #include <memory>
-#include <stack>
 #include <optional>
-#include <utility>
-#include <iostream>
-#include <SFML/Graphics.hpp>
+#include <string>
+#include <string_view>
 
 #include "Game.hpp"
+#include "bench/Benchmark.hpp"
 #include "key/KeyControls.hpp"
+#include "loop/FramePacer.hpp"
+#include "loop/GameLoop.hpp"
+#include "loop/InputCapture.hpp"
+#include "loop/InputRecorder.hpp"
+#include "loop/InputReplay.hpp"
+#include "render/AtlasPacker.hpp"
+#include "render/NullBackend.hpp"
+#include "render/WindowBackend.hpp"
+#include "settings/SettingsService.hpp"
 
-int main()
+int main(int argc, char* argv[])
 {
-	nemo::Game game;
-	nemo::KeyControls controls_;
+	// Command line options.
+	auto threaded_render = false;
+	auto headless = false;
+	auto capture_input = false;
+	auto frames = std::size_t(0);
+	std::string record_file;
+	std::string replay_file;
+
+	for (auto i = 1; i < argc; ++i) {
+		const std::string_view arg = argv[i];
+
+		if (arg == "--threaded-render") {
+			threaded_render = true;
+		}
+		else if (arg == "--headless") {
+			// Run without a display, as fast as possible.
+			headless = true;
+		}
+		else if (arg == "--capture-input") {
+			// Stamp key presses on a dedicated thread.
+			capture_input = true;
+		}
+		else if (arg == "--frames" && i + 1 < argc) {
+			// Quit a headless run after this many frames.
+			frames = std::strtoull(argv[++i], nullptr, 10);
+		}
+		else if (arg == "--record" && i + 1 < argc) {
+			// Save the inputs of this session.
+			record_file = argv[++i];
+		}
+		else if (arg == "--replay" && i + 1 < argc) {
+			// Play back a saved session instead of taking key presses.
+			replay_file = argv[++i];
+		}
+		else if (arg == "--bench" && i + 1 < argc) {
+			// Run benchmarks instead of the game. Any failed check fails the 
+			// run, so that scripts can rely on the exit code.
+			return nemo::runBenchmark(argv[i + 1], std::cout) 
+				? EXIT_SUCCESS 
+				: EXIT_FAILURE;
+		}
+		else if (arg == "--pack-atlas" && i + 2 < argc) {
+			// Build a texture atlas from a directory of images and quit.
+			return nemo::packAtlas(argv[i + 1], argv[i + 2], std::cout) 
+				? EXIT_SUCCESS 
+				: EXIT_FAILURE;
+		}
+	}
 
-	// Open a window.
-	sf::RenderWindow window(sf::VideoMode(1280, 720), "Nemo");
-	window.setFramerateLimit(30);
-	window.setKeyRepeatEnabled(false);
+	nemo::SettingsService settings;
+	nemo::KeyControls controls_(settings);
+	nemo::Game game(controls_.actions(), headless);
+
+	// Open a window, or pretend to.
+	std::unique_ptr<nemo::RenderBackend> backend;
+	if (headless) {
+		backend = std::make_unique<nemo::NullBackend>(frames);
+	}
+	else {
+		backend = std::make_unique<nemo::WindowBackend>(1280, 720, "Nemo");
+	}
+
+	nemo::GameLoop loop(game, controls_, threaded_render);
+
+	std::optional<nemo::InputRecorder> recorder;
+	if (!record_file.empty()) {
+		loop.recordTo(recorder.emplace(record_file));
+	}
+
+	std::optional<nemo::InputCapture> capture;
+	if (capture_input) {
+		loop.captureFrom(capture.emplace(controls_.actions()));
+	}
+
+	std::optional<nemo::InputReplay> replay;
+	if (!replay_file.empty()) {
+		if (!replay.emplace().load(replay_file, std::cerr)) {
+			return EXIT_FAILURE;
+		}
+		loop.replayFrom(*replay);
+	}
+
+	// Headless runs and replays go as fast as they can. Otherwise, save power 
+	// when there's nothing to show.
+	nemo::FramePacer pacer;
+	if (!headless && !replay) {
+		loop.paceFrames(pacer);
+	}
 
 	// Run the program as long as its window is open.
-	while (window.isOpen()) {
-		window.clear(sf::Color::White);
-		std::optional<nemo::KeyAction> input;
-
-		// Check for pending events.
-		if (sf::Event event;
-			window.pollEvent(event))
-		{
-			switch (event.type) {
-				case sf::Event::Closed:
-					window.close();
-				break;
-
-				case sf::Event::LostFocus:
-					game.pause();
-				break;
-
-				case sf::Event::GainedFocus:
-					game.resume();
-				break;
-
-				case sf::Event::KeyPressed: {
-					const nemo::Key pressed_key(event.key.code);
-					input = { controls_.convert(nemo::Key(event.key.code)) };
-				}
-				break;
-				
-				default:
-				break;
-			}
-		}
-
-		game.update(input, window);
-		window.display();
+	loop.run(*backend);
+	loop.report(std::cout);
+
+	if (const auto null = dynamic_cast<const nemo::NullBackend*>(backend.get())) {
+		std::cout << "headless: " 
+			<< null->frameCount() << " frames, " 
+			<< null->drawCount() << " draw calls" << std::endl;
 	}
 
 	return EXIT_SUCCESS;
-}
\ No newline at end of file
+}
@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <new>
+#include <boost/assert.hpp>
+
+#include "BlockPool.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+BlockPool::BlockPool(
+	const std::size_t block_size, 
+	const std::size_t alignment, 
+	const std::size_t chunk_size
+)
+	: alignment_(std::max(alignment, alignof(FreeBlock)))
+	, chunk_size_(chunk_size)
+{
+	BOOST_ASSERT(chunk_size_ > 0);
+	BOOST_ASSERT((alignment_ & (alignment_ - 1)) == 0);
+
+	// Every block must be able to hold a free list link, and keep the next 
+	// one aligned.
+	const auto size = std::max(block_size, sizeof(FreeBlock));
+	block_size_ = (size + alignment_ - 1) / alignment_ * alignment_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+BlockPool::~BlockPool()
+{
+	for (auto chunk : chunks_) {
+		::operator delete(chunk, std::align_val_t(alignment_));
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void*
+BlockPool::allocate()
+{
+	if (free_ == nullptr) {
+		grow();
+	}
+
+	auto block = free_;
+	free_ = block->next_;
+
+	++size_;
+	high_water_ = std::max(high_water_, size_);
+	return block;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+BlockPool::deallocate(void* block)
+noexcept
+{
+	BOOST_ASSERT(block != nullptr);
+	BOOST_ASSERT(size_ > 0);
+
+	free_ = ::new (block) FreeBlock{ free_ };
+	--size_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+PoolStats
+BlockPool::stats()
+const noexcept
+{
+	return { size_, chunks_.size() * chunk_size_, high_water_ };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+BlockPool::grow()
+{
+	auto chunk = static_cast<unsigned char*>(::operator new(
+		block_size_ * chunk_size_, std::align_val_t(alignment_)
+	));
+	chunks_.push_back(chunk);
+
+	for (std::size_t i = chunk_size_; i-- > 0;) {
+		free_ = ::new (chunk + i * block_size_) FreeBlock{ free_ };
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "memory/PoolStats.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Allocator of fixed-size memory blocks.
+ * 
+ * Blocks are carved from chunks that are kept until the pool is destroyed, 
+ * and freed blocks go to a free list, so allocating and freeing are O(1) and 
+ * don't call the system allocator once the pool has warmed up.
+ * 
+ * A BlockPool is not thread-safe.
+ ***/
+class BlockPool
+{
+public:
+	/***
+	 * @brief Constructor.
+	 * 
+	 * @param block_size  - Size of each block, in bytes.
+	 * @param alignment   - Alignment of each block.
+	 * @param chunk_size  - Number of blocks to allocate at a time.
+	 ***/
+	BlockPool(
+		const std::size_t block_size, 
+		const std::size_t alignment, 
+		const std::size_t chunk_size = 256
+	);
+
+	BlockPool(const BlockPool&)
+	= delete;
+
+	BlockPool&
+	operator= (const BlockPool&)
+	= delete;
+
+	~BlockPool();
+
+	/***
+	 * @brief Take a block.
+	 * 
+	 * @return Uninitialized block.
+	 ***/
+	void*
+	allocate();
+
+	/***
+	 * @brief Give a block back.
+	 * 
+	 * @param block       - Block taken from this pool.
+	 ***/
+	void
+	deallocate(void* block)
+	noexcept;
+
+	/***
+	 * @brief Get the pool's occupancy, in blocks.
+	 * 
+	 * @return Statistics.
+	 ***/
+	PoolStats
+	stats()
+	const noexcept;
+
+private:
+	struct FreeBlock
+	{
+		FreeBlock* next_;
+	};
+
+	/***
+	 * @brief Add a chunk of free blocks.
+	 ***/
+	void
+	grow();
+
+	/***
+	 * @brief Private attributes.
+	 ***/
+	std::size_t        block_size_; ///< Block size, rounded up to alignment.
+	std::size_t        alignment_;  ///< Block alignment.
+	std::size_t        chunk_size_; ///< Blocks per chunk.
+	std::vector<void*> chunks_;     ///< Chunks allocated so far.
+	FreeBlock*         free_ = nullptr; ///< Free list head.
+	std::size_t        size_ = 0;       ///< Blocks in use.
+	std::size_t        high_water_ = 0; ///< Most blocks in use at once.
+};
+
+/***
+ * @brief Mixin that makes `new` and `delete` of a class use a @class BlockPool 
+ * of its own.
+ * 
+ * Derive a component from it to pool its allocations without changing how it 
+ * is created or owned:
+ * 
+ *     class Bullet : public Physics, public Pooled<Bullet> { ... };
+ *     auto physics = std::make_unique<Bullet>(); // Comes from the pool.
+ * 
+ * Deleting through a base class pointer returns the block to the pool as 
+ * long as the base class has a virtual destructor, which @class Input, 
+ * @class Physics, and @class Graphics do. Classes further derived from 
+ * @p Derived have a different size and fall back to the global allocator.
+ * 
+ * Like @class BlockPool, this is not thread-safe: pooled objects should be 
+ * created and destroyed on the simulation thread.
+ ***/
+template <typename Derived>
+class Pooled
+{
+public:
+	static void*
+	operator new(const std::size_t size)
+	{
+		return size == sizeof(Derived) ? pool().allocate() : ::operator new(size);
+	}
+
+	static void
+	operator delete(void* ptr, const std::size_t size)
+	noexcept
+	{
+		if (size == sizeof(Derived)) {
+			pool().deallocate(ptr);
+		}
+		else {
+			::operator delete(ptr);
+		}
+	}
+
+	/***
+	 * @brief Get the pool the class allocates from.
+	 * 
+	 * @return Pool.
+	 ***/
+	static BlockPool&
+	pool()
+	{
+		// Never destroyed, so objects that outlive it at exit can still be 
+		// deleted.
+		static auto& pool = *new BlockPool(sizeof(Derived), alignof(Derived));
+		return pool;
+	}
+};
+
+}
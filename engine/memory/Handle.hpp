@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+
+namespace nemo
+{
+
+/***
+ * @brief Handle to an object in a @class Pool.
+ * 
+ * The index is reused once the object is destroyed, but the generation is 
+ * bumped, so handles to a destroyed object never refer to a new one.
+ ***/
+template <typename T>
+struct Handle
+{
+	std::uint32_t index_;      ///< Slot in the pool.
+	std::uint32_t generation_; ///< Times the slot has been reused.
+
+	bool
+	operator== (const Handle& rhs)
+	const noexcept
+	{
+		return index_ == rhs.index_ && generation_ == rhs.generation_;
+	}
+
+	bool
+	operator!= (const Handle& rhs)
+	const noexcept
+	{
+		return !(*this == rhs);
+	}
+};
+
+}
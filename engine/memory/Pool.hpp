@@ -0,0 +1,312 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+#include <boost/assert.hpp>
+
+#include "memory/Handle.hpp"
+#include "memory/PoolStats.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Pool of objects of one type, addressed through generational handles.
+ * 
+ * Objects live in fixed-size chunks that are never moved or freed until the 
+ * pool is destroyed, so creating and destroying objects is O(1) and doesn't 
+ * allocate once the pool has grown to the largest number of objects alive at 
+ * once. Pointers to an object stay valid until it's destroyed.
+ ***/
+template <typename T>
+class Pool
+{
+public:
+	/***
+	 * @brief Number of objects per chunk.
+	 ***/
+	static constexpr std::size_t chunk_size = 256;
+
+	Pool()
+	= default;
+
+	Pool(const Pool&)
+	= delete;
+
+	Pool&
+	operator= (const Pool&)
+	= delete;
+
+	/***
+	 * @brief Destroy all objects still alive.
+	 ***/
+	~Pool();
+
+	/***
+	 * @brief Grow the pool so that it can hold a number of objects without 
+	 * allocating again.
+	 * 
+	 * @param capacity    - Number of objects.
+	 ***/
+	void
+	reserve(const std::size_t capacity);
+
+	/***
+	 * @brief Construct an object in the pool.
+	 * 
+	 * @param args        - Constructor arguments.
+	 * 
+	 * @return Handle to the new object.
+	 ***/
+	template <typename... Args>
+	Handle<T>
+	create(Args&&... args);
+
+	/***
+	 * @brief Destroy an object. Handles to it become stale.
+	 * 
+	 * This method generates an assertion error if the object is already dead.
+	 * 
+	 * @param handle      - Object to destroy.
+	 ***/
+	void
+	destroy(const Handle<T> handle);
+
+	/***
+	 * @brief Indicates whether a handle still refers to a live object.
+	 * 
+	 * @param handle      - Handle to check.
+	 * 
+	 * @return True if yes, false otherwise.
+	 ***/
+	bool
+	alive(const Handle<T> handle)
+	const noexcept;
+
+	/***
+	 * @brief Get an object.
+	 * 
+	 * @param handle      - Handle to the object.
+	 * 
+	 * @return The object, or nullptr if the handle is stale.
+	 ***/
+	T*
+	get(const Handle<T> handle)
+	noexcept;
+
+	const T*
+	get(const Handle<T> handle)
+	const noexcept;
+
+	/***
+	 * @brief Call a function for every live object, in slot order.
+	 * 
+	 * Objects must not be created or destroyed while the iteration is running.
+	 * 
+	 * @param fn          - Callable taking a reference to the object.
+	 ***/
+	template <typename Fn>
+	void
+	each(Fn&& fn);
+
+	/***
+	 * @brief Get the pool's occupancy.
+	 * 
+	 * @return Statistics.
+	 ***/
+	PoolStats
+	stats()
+	const noexcept;
+
+private:
+	static constexpr auto no_slot = std::uint32_t(-1);
+
+	struct Slot
+	{
+		alignas(T) unsigned char storage_[sizeof(T)];
+		std::uint32_t generation_ = 0;     ///< Times the slot has been reused.
+		std::uint32_t next_free_ = no_slot; ///< Next slot in the free list.
+		bool          live_ = false;       ///< Whether it holds an object.
+
+		T*
+		object()
+		noexcept
+		{
+			return std::launder(reinterpret_cast<T*>(storage_));
+		}
+	};
+
+	Slot&
+	slot(const std::uint32_t index)
+	const noexcept
+	{
+		return chunks_[index / chunk_size][index % chunk_size];
+	}
+
+	/***
+	 * @brief Add a chunk of free slots.
+	 ***/
+	void
+	grow();
+
+	/***
+	 * @brief Private attributes.
+	 ***/
+	std::vector<std::unique_ptr<Slot[]>> chunks_;   ///< Slot storage.
+	std::uint32_t                        free_ = no_slot; ///< Free list head.
+	std::size_t                          size_ = 0;       ///< Live objects.
+	std::size_t                          high_water_ = 0; ///< Most live objects.
+};
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+Pool<T>::~Pool()
+{
+	each([](T& obj) { obj.~T(); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+void
+Pool<T>::reserve(const std::size_t capacity)
+{
+	while (chunks_.size() * chunk_size < capacity) {
+		grow();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+template <typename... Args>
+Handle<T>
+Pool<T>::create(Args&&... args)
+{
+	if (free_ == no_slot) {
+		grow();
+	}
+
+	const auto index = free_;
+	auto& s = slot(index);
+	::new (s.storage_) T(std::forward<Args>(args)...);
+	free_ = s.next_free_;
+	s.live_ = true;
+
+	++size_;
+	high_water_ = std::max(high_water_, size_);
+	return { index, s.generation_ };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+void
+Pool<T>::destroy(const Handle<T> handle)
+{
+	BOOST_ASSERT(alive(handle));
+	auto& s = slot(handle.index_);
+
+	s.object()->~T();
+	s.live_ = false;
+	++s.generation_;
+	s.next_free_ = free_;
+	free_ = handle.index_;
+	--size_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+bool
+Pool<T>::alive(const Handle<T> handle)
+const noexcept
+{
+	if (handle.index_ >= chunks_.size() * chunk_size) {
+		return false;
+	}
+
+	const auto& s = slot(handle.index_);
+	return s.live_ && s.generation_ == handle.generation_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+T*
+Pool<T>::get(const Handle<T> handle)
+noexcept
+{
+	return alive(handle) ? slot(handle.index_).object() : nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+const T*
+Pool<T>::get(const Handle<T> handle)
+const noexcept
+{
+	return alive(handle) ? slot(handle.index_).object() : nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+template <typename Fn>
+void
+Pool<T>::each(Fn&& fn)
+{
+	for (auto& chunk : chunks_) {
+		for (std::size_t i = 0; i < chunk_size; ++i) {
+			if (chunk[i].live_) {
+				fn(*chunk[i].object());
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+PoolStats
+Pool<T>::stats()
+const noexcept
+{
+	return { size_, chunks_.size() * chunk_size, high_water_ };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+void
+Pool<T>::grow()
+{
+	const auto first = std::uint32_t(chunks_.size() * chunk_size);
+	chunks_.push_back(std::make_unique<Slot[]>(chunk_size));
+	auto& chunk = chunks_.back();
+
+	// Thread the new slots onto the free list, lowest index first.
+	for (std::size_t i = chunk_size; i-- > 0;) {
+		chunk[i].next_free_ = free_;
+		free_ = first + std::uint32_t(i);
+	}
+}
+
+}
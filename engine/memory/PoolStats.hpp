@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+
+namespace nemo
+{
+
+/***
+ * @brief Occupancy of an object or memory pool.
+ ***/
+struct PoolStats
+{
+	std::size_t size_       = 0; ///< Objects currently allocated.
+	std::size_t capacity_   = 0; ///< Objects that fit without growing.
+	std::size_t high_water_ = 0; ///< Most objects ever allocated at once.
+};
+
+}
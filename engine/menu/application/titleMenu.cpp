@@ -4,10 +4,11 @@ namespace nemo
 {
 
 std::shared_ptr<MenuNode>
-createTitleMenu()
+createTitleMenu(const bool headless)
 {
 	MenuNodeFactory factory;
 	factory.setDefaultConfig("data/menu/title.json");
+	factory.setHeadless(headless);
 
 	std::shared_ptr<MenuNode> menu = factory.create(MenuNodeType::Tree);
 	menu->setCaption("hello");
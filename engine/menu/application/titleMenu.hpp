@@ -8,7 +8,14 @@
 namespace nemo
 {
 
+/***
+ * @brief Create the title menu.
+ * 
+ * @param headless    - Whether to run without a graphics context.
+ * 
+ * @return The title menu.
+ ***/
 std::shared_ptr<MenuNode>
-createTitleMenu();
+createTitleMenu(const bool headless);
 
 }
\ No newline at end of file
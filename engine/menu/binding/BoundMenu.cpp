@@ -0,0 +1,146 @@
+#include <algorithm>
+#include <utility>
+#include <boost/assert.hpp>
+
+#include "BoundMenu.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+BoundMenu::BoundMenu(const MenuNodeFactory& factory, const std::string& file)
+	: factory_(factory)
+	, menu_(std::static_pointer_cast<MenuTree>(
+		factory.create(MenuNodeType::Tree, file)))
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+BoundMenu::append(const int key, const std::string_view label, 
+	const std::size_t count)
+{
+	insert(rows_.size(), { key, std::string(label), count });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+BoundMenu::apply(const ListChange& change)
+{
+	switch (change.type_) {
+		case ListChange::Type::Added:
+			insert(0, { change.key_, std::string(change.label_), change.count_ });
+			break;
+
+		case ListChange::Type::Removed: {
+			const auto idx = find(change.key_);
+			indices_.erase(change.key_);
+			rows_.erase(rows_.cbegin() + idx);
+			reindex(idx, rows_.size());
+			menu_->erase(idx);
+			break;
+		}
+
+		case ListChange::Type::CountChanged: {
+			// Nothing moves, so only the caption is made again.
+			const auto idx = find(change.key_);
+			rows_[idx].count_ = change.count_;
+			menu_->at(idx)->setCaption(caption(rows_[idx]));
+			break;
+		}
+
+		case ListChange::Type::MovedToFront: {
+			const auto idx = find(change.key_);
+			std::rotate(rows_.begin(), rows_.begin() + idx, 
+				rows_.begin() + idx + 1);
+			reindex(0, idx + 1);
+			menu_->move(idx, 0);
+			break;
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::optional<int>
+BoundMenu::selected()
+const noexcept
+{
+	if (rows_.empty()) {
+		return std::nullopt;
+	}
+
+	return rows_[menu_->cursor()].key_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::shared_ptr<MenuTree>
+BoundMenu::menu()
+const noexcept
+{
+	return menu_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+BoundMenu::insert(const std::size_t idx, Row row)
+{
+	auto item = factory_.create(MenuNodeType::Leaf);
+	item->setCaption(caption(row));
+	menu_->insert(idx, std::move(item));
+	rows_.insert(rows_.cbegin() + idx, std::move(row));
+	reindex(idx, rows_.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+BoundMenu::reindex(const std::size_t first, const std::size_t last)
+{
+	for (auto idx = first; idx < last; ++idx) {
+		indices_[rows_[idx].key_] = idx;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+BoundMenu::find(const int key)
+const noexcept
+{
+	// Lookups are constant time; the rows shifted by a change are reindexed 
+	// along with the menu items, which move anyway.
+	const auto it = indices_.find(key);
+	BOOST_ASSERT(it != indices_.cend());
+
+	return it->second;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::string
+BoundMenu::caption(const Row& row)
+{
+	return row.count_ > 1 
+		? row.label_ + " x" + std::to_string(row.count_) 
+		: row.label_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
\ No newline at end of file
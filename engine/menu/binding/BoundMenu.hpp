@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "menu/composite/MenuTree.hpp"
+#include "menu/factory/MenuNodeFactory.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief One change to a list ordered from most recently touched entry to least 
+ * recently, such as the player's inventory.
+ ***/
+struct ListChange
+{
+	/***
+	 * @brief Enumeration for what happened to the entry.
+	 ***/
+	enum class Type {
+		Added,        ///< New entry, now at the front.
+		Removed,      ///< Entry no longer in the list.
+		CountChanged, ///< Same place, different quantity.
+		MovedToFront  ///< Same quantity, now at the front.
+	};
+
+	Type             type_;  ///< What happened to the entry.
+	int              key_;   ///< Key identifying the entry, e.g. an item's ID.
+	std::size_t      count_; ///< Quantity of the entry after the change.
+	std::string_view label_; ///< Name of the entry. Only read when added.
+};
+
+/***
+ * @brief Menu kept in sync with a list of counted entries by applying the 
+ * list's changes one at a time.
+ * 
+ * Each entry of the list is shown as a menu item, captioned with its label and, 
+ * if there are more than one, its quantity. A change only inserts, removes, 
+ * moves or recaptions the menu items it concerns, and only the items at or 
+ * after the first affected index are placed again. The cursor stays over the 
+ * same entry across changes.
+ ***/
+class BoundMenu
+{
+public:
+	/***
+	 * @brief Construct an empty bound menu.
+	 * 
+	 * @param factory    - Factory creating the menu and its items.
+	 * @param file       - Configuration file for the menu. If unspecified, use 
+	 *                     the factory's default configurations.
+	 ***/
+	BoundMenu(const MenuNodeFactory& factory, const std::string& file = "");
+
+	BoundMenu(const BoundMenu&) = delete;
+	BoundMenu& operator=(const BoundMenu&) = delete;
+
+	/***
+	 * @brief Add an entry after all others, e.g. while filling the menu with 
+	 * the list's current contents.
+	 * 
+	 * @param key        - Key identifying the entry.
+	 * @param label      - Name of the entry.
+	 * @param count      - Quantity of the entry.
+	 ***/
+	void
+	append(const int key, const std::string_view label, const std::size_t count);
+
+	/***
+	 * @brief Apply a change made to the list.
+	 * 
+	 * @param change     - What changed.
+	 ***/
+	void
+	apply(const ListChange& change);
+
+	/***
+	 * @brief Get the key of the entry the cursor is over.
+	 * 
+	 * @return Key of the hovered entry, or nullopt if the menu is empty.
+	 ***/
+	std::optional<int>
+	selected()
+	const noexcept;
+
+	/***
+	 * @brief Get the menu showing the entries.
+	 * 
+	 * @return The menu.
+	 ***/
+	std::shared_ptr<MenuTree>
+	menu()
+	const noexcept;
+
+private:
+	/***
+	 * @brief What is shown of one entry.
+	 ***/
+	struct Row
+	{
+		int         key_;   ///< Key identifying the entry.
+		std::string label_; ///< Name of the entry.
+		std::size_t count_; ///< Quantity of the entry.
+	};
+
+	/***
+	 * @brief Create a menu item for an entry and insert it.
+	 * 
+	 * @param idx        - Index the entry will have.
+	 * @param row        - Entry to show.
+	 ***/
+	void
+	insert(const std::size_t idx, Row row);
+
+	/***
+	 * @brief Record where the entries in a range of rows are now shown, after 
+	 * the rows were shifted.
+	 * 
+	 * @param first      - Index of the first shifted row.
+	 * @param last       - Index past the last shifted row.
+	 ***/
+	void
+	reindex(const std::size_t first, const std::size_t last);
+
+	/***
+	 * @brief Find where an entry is shown.
+	 * 
+	 * @param key        - Key identifying the entry.
+	 * 
+	 * @return Index of the entry. Generates an assertion error if there is none.
+	 ***/
+	std::size_t
+	find(const int key)
+	const noexcept;
+
+	/***
+	 * @brief Make an entry's caption.
+	 * 
+	 * @param row        - Entry to show.
+	 * 
+	 * @return Label followed by the quantity if there are more than one.
+	 ***/
+	static std::string
+	caption(const Row& row);
+
+	MenuNodeFactory           factory_; ///< Factory creating the menu items.
+	std::shared_ptr<MenuTree> menu_;    ///< Menu showing the entries.
+	std::vector<Row>          rows_;    ///< Entries, in the order of the menu.
+	std::unordered_map<int, std::size_t> indices_; ///< Index of each key's row.
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include "InventoryMenu.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+InventoryMenu::InventoryMenu(Inventory& inventory, BoundMenu& menu)
+	: inventory_(inventory)
+	, menu_     (menu)
+{
+	// Appending in recency order places each entry after the ones before it, 
+	// so nothing is placed twice.
+	for (const auto slot : inventory_.view()) {
+		menu_.append(slot.id_, slot.name_, slot.count_);
+	}
+
+	inventory_.subscribe(*this);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+InventoryMenu::~InventoryMenu()
+{
+	inventory_.unsubscribe(*this);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+InventoryMenu::inventoryChanged(const InventoryChange& change)
+{
+	ListChange bound{ ListChange::Type::Added, change.id_, change.count_, {} };
+
+	switch (change.type_) {
+		case InventoryChange::Type::Added:
+			// A new item is at the front of the inventory, which is where its 
+			// name can be found without a search.
+			bound.label_ = (*inventory_.view().begin()).name_;
+			break;
+
+		case InventoryChange::Type::Removed:
+			bound.type_ = ListChange::Type::Removed;
+			break;
+
+		case InventoryChange::Type::CountChanged:
+			bound.type_ = ListChange::Type::CountChanged;
+			break;
+
+		case InventoryChange::Type::MovedToFront:
+			bound.type_ = ListChange::Type::MovedToFront;
+			break;
+	}
+
+	menu_.apply(bound);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "item/Inventory.hpp"
+#include "item/InventoryListener.hpp"
+#include "menu/binding/BoundMenu.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Keeps a menu showing an inventory in sync with it.
+ * 
+ * The menu is filled once with what the inventory holds, then every change to 
+ * the inventory is passed on to it, so picking up or discarding an item only 
+ * touches that item's entry instead of rebuilding the menu.
+ ***/
+class InventoryMenu : public InventoryListener
+{
+public:
+	/***
+	 * @brief Fill a menu with an inventory's items and follow its changes.
+	 * 
+	 * @param inventory   - Inventory to show. Must outlive this object.
+	 * @param menu        - Menu to show it in, empty. Must outlive this object.
+	 ***/
+	InventoryMenu(Inventory& inventory, BoundMenu& menu);
+
+	/***
+	 * @brief Stop following the inventory's changes.
+	 ***/
+	~InventoryMenu();
+
+	InventoryMenu(const InventoryMenu&) = delete;
+	InventoryMenu& operator=(const InventoryMenu&) = delete;
+
+	void
+	inventoryChanged(const InventoryChange& change)
+	override;
+
+private:
+	Inventory& inventory_; ///< Inventory shown.
+	BoundMenu& menu_;      ///< Menu showing it.
+};
+
+}
@@ -16,10 +16,10 @@ MenuLeaf::add(std::shared_ptr<MenuNode> child)
 ////////////////////////////////////////////////////////////////////////////////
 
 void
-MenuLeaf::drawIt(sf::RenderWindow& window)
+MenuLeaf::drawIt(RenderList& list)
 const
 {
-	drawTextBox(window);
+	drawTextBox(list);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
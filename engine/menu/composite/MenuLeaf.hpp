@@ -35,7 +35,7 @@ public:
 	 * @brief
 	 ***/
 	void
-	drawIt(sf::RenderWindow& window)
+	drawIt(RenderList& list)
 	const override;
 
 	/***
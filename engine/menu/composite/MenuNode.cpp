@@ -61,6 +61,8 @@ MenuNode::setPosition(const XYPair& pos)
 	const auto pos_v = sfVector2(pos);
 	const auto padding_v = space_.getPosition() - cell_.getPosition();
 	
+	// The caption was aligned inside the cell, so it moves along with it.
+	caption_.move(pos_v - cell_.getPosition());
 	cell_.setPosition(pos_v);
 	space_.setPosition(pos_v + padding_v);
 	return shared_from_this();
@@ -111,22 +113,26 @@ const noexcept
 std::shared_ptr<MenuNode>
 MenuNode::makeCaption(const std::string& caption, bool vt_center)
 {
+	// Measuring the text loads its glyphs into the font, which the render 
+	// thread may be reading.
+	const std::lock_guard lock(RenderList::fontMutex());
+
 	// Create graphical text.
 	caption_.setFont(*font_.family_);
 	caption_.setString(caption);
 	caption_.setCharacterSize(font_.size_);
 	caption_.setPosition(space_.getPosition());
 	
+	const auto caption_size = captionSize();
+
 	// Vertically align the title.
 	const auto space_height = YValue(space_.getSize().y);
-	const auto caption_height = YValue(caption_.getLocalBounds().height);
 	const auto y_to_move = vt_center 
-		? (space_height - caption_height) / YValue(2.f) // Center.
+		? (space_height - caption_size.y_) / YValue(2.f) // Center.
 		: YValue(5.f);                                  // Top.
 	
 	// Horizontally align the title.
 	auto x_to_move = XValue(5.f);
-	const auto caption_width = XValue(caption_.getLocalBounds().width);
 	const auto space_width = XValue(space_.getSize().x);
 
 	switch (font_.align_) {
@@ -134,11 +140,11 @@ MenuNode::makeCaption(const std::string& caption, bool vt_center)
 			break;
 
 		case Alignment::Center:
-			x_to_move = (space_width - caption_width) / XValue(2.f);
+			x_to_move = (space_width - caption_size.x_) / XValue(2.f);
 			break;
 
 		case Alignment::Right:
-			x_to_move = space_width - caption_width - x_to_move;
+			x_to_move = space_width - caption_size.x_ - x_to_move;
 			break;
 	}
 
@@ -149,12 +155,30 @@ MenuNode::makeCaption(const std::string& caption, bool vt_center)
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 
+XYPair
+MenuNode::captionSize()
+const
+{
+	if (font_.glyphs_) {
+		const auto bounds = caption_.getLocalBounds();
+		return { XValue(bounds.width), YValue(bounds.height) };
+	}
+
+	// About half an em per character, and the height of a capital.
+	const auto size = float(font_.size_);
+	const auto length = float(caption_.getString().getSize());
+	return { XValue(0.5f * size * length), YValue(0.7f * size) };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
 void 
-MenuNode::drawTextBox(sf::RenderWindow& window)
+MenuNode::drawTextBox(RenderList& list)
 const
 {
-	window.draw(cell_);
-	window.draw(caption_);
+	list.draw(cell_);
+	list.draw(caption_);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
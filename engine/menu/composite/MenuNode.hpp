@@ -4,10 +4,10 @@
 #include <string>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/Text.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
 
 #include "type_safe/strong_typedef.hpp"
 
+#include "render/RenderList.hpp"
 #include "utility/type/FontProperties.hpp"
 #include "utility/type/Color.hpp"
 #include "utility/type/XY.hpp"
@@ -52,10 +52,12 @@ public:
 	add(std::shared_ptr<MenuNode> child) = 0;
 
 	/***
-	 * @brief
+	 * @brief Record the menu node's draw calls.
+	 * 
+	 * @param list       - Render list for the current frame.
 	 ***/
 	virtual void
-	drawIt(sf::RenderWindow& window)
+	drawIt(RenderList& list)
 	const = 0;
 
 	/***
@@ -131,15 +133,28 @@ protected:
 	makeCaption(const std::string& caption, bool vt_center);
 
 	/***
-	 * @brief Draw the menu node on the render window.
+	 * @brief Record the menu node's cell and caption.
 	 * 
-	 * @param window     - Render window.
+	 * @param list       - Render list for the current frame.
 	 ***/
 	void
-	drawTextBox(sf::RenderWindow& window)
+	drawTextBox(RenderList& list)
 	const;
 
 private:
+	/***
+	 * @brief Get the size of the caption.
+	 * 
+	 * Measuring rasterises the caption's glyphs, which needs a graphics 
+	 * context. Without one, the size is estimated from the character size, 
+	 * which is enough to lay out a menu that is never shown.
+	 * 
+	 * @return Width and height of the caption.
+	 ***/
+	XYPair
+	captionSize()
+	const;
+
 	/***
 	 * @brief Member attributes
 	 ***/
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <boost/assert.hpp>
 #include <iostream>
 #include <fstream>
@@ -43,34 +44,130 @@ MenuTree::MenuTree(
 std::shared_ptr<MenuNode>
 MenuTree::add(const std::shared_ptr<MenuNode> child)
 {
-	const auto row_by_col = XYPair(XValue(int(cols_)), YValue(int(rows_)));
-	const auto spaced_dim = getInnerSize() / row_by_col;
-	const auto dim = spaced_dim - spacing_ * 2.f;
-	child->setSize(dim);
+	insert(children_.size(), child);
+	return shared_from_this();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
 
-	const auto rc_i = RC1DConverter(cols_).toRowColumn(children_.size());
-	const auto rel_pos = spaced_dim 
-		* XYPair(XValue(int(rc_i.c_)), YValue(int(rc_i.r_)))
-		+ spacing_;
-	const auto abs_pos = getPosition() + rel_pos;
-	child->setPosition(abs_pos);
+void
+MenuTree::insert(const std::size_t idx, std::shared_ptr<MenuNode> child)
+{
+	BOOST_ASSERT(idx <= children_.size());
 
+	child->setSize(cellSize() - spacing_ * 2.f);
 	child->setColors(entry_colors_);
-	children_.push_back(child);
-	return shared_from_this();
+
+	// Keep the cursor over the same entry. An empty menu has none, so the cursor 
+	// goes over the new one.
+	if (!children_.empty() && idx <= std::size_t(cursor_.idx_)) {
+		++cursor_.idx_;
+	}
+
+	children_.insert(children_.cbegin() + idx, std::move(child));
+	layout(idx, children_.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+MenuTree::erase(const std::size_t idx)
+{
+	BOOST_ASSERT(idx < children_.size());
+
+	children_.erase(children_.cbegin() + idx);
+
+	// Keep the cursor over the same entry, or over the one that took the place 
+	// of the removed one, unless it was the last.
+	const auto n = static_cast<decltype(cursor_.idx_)>(children_.size());
+	if (idx < std::size_t(cursor_.idx_) || cursor_.idx_ == n && n > 0) {
+		--cursor_.idx_;
+	}
+
+	layout(idx, children_.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+MenuTree::move(const std::size_t from, const std::size_t to)
+{
+	BOOST_ASSERT(from < children_.size());
+	BOOST_ASSERT(to < children_.size());
+
+	const auto first = children_.begin() + std::min(from, to);
+	const auto last = children_.begin() + std::max(from, to) + 1;
+	const auto cursor = std::size_t(cursor_.idx_);
+
+	// Shift the entries in between by one toward where the moved entry was, 
+	// and the cursor along with them.
+	if (from < to) {
+		std::rotate(first, first + 1, last);
+		if (cursor == from) {
+			cursor_.idx_ = int(to);
+		}
+		else if (from < cursor && cursor <= to) {
+			--cursor_.idx_;
+		}
+	}
+	else {
+		std::rotate(first, last - 1, last);
+		if (cursor == from) {
+			cursor_.idx_ = int(to);
+		}
+		else if (to <= cursor && cursor < from) {
+			++cursor_.idx_;
+		}
+	}
+
+	layout(std::min(from, to), std::max(from, to) + 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::shared_ptr<MenuNode>
+MenuTree::at(const std::size_t idx)
+const
+{
+	BOOST_ASSERT(idx < children_.size());
+	return children_[idx];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+MenuTree::size()
+const noexcept
+{
+	return children_.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+MenuTree::cursor()
+const noexcept
+{
+	return std::size_t(cursor_.idx_);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 
 void 
-MenuTree::drawIt(sf::RenderWindow& window)
+MenuTree::drawIt(RenderList& list)
 const
 {
-	drawTextBox(window);
+	drawTextBox(list);
 
 	for (auto c : children_) {
-		c->drawIt(window);
+		c->drawIt(list);
 	}
 }
 
@@ -178,4 +275,33 @@ noexcept
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 
+void
+MenuTree::layout(const std::size_t first, const std::size_t last)
+{
+	const auto spaced_dim = cellSize();
+	const auto converter = RC1DConverter(cols_);
+
+	for (auto i = first; i < last; ++i) {
+		const auto rc_i = converter.toRowColumn(int(i));
+		const auto rel_pos = spaced_dim 
+			* XYPair(XValue(int(rc_i.c_)), YValue(int(rc_i.r_)))
+			+ spacing_;
+		children_[i]->setPosition(getPosition() + rel_pos);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+XYPair
+MenuTree::cellSize()
+const noexcept
+{
+	const auto row_by_col = XYPair(XValue(int(cols_)), YValue(int(rows_)));
+	return getInnerSize() / row_by_col;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -72,11 +73,76 @@ public:
 	add(std::shared_ptr<MenuNode> child) 
 	override;
 
+	/***
+	 * @brief Insert an entry before another one.
+	 * 
+	 * @param idx        - Index the new entry will have, at most the number of 
+	 *                     entries.
+	 * @param child      - Entry to insert.
+	 * 
+	 * Only the entries from @p idx onward are moved on screen. The cursor stays 
+	 * on the entry it was over.
+	 ***/
+	void
+	insert(const std::size_t idx, std::shared_ptr<MenuNode> child);
+
+	/***
+	 * @brief Remove an entry.
+	 * 
+	 * @param idx        - Index of the entry to remove.
+	 * 
+	 * Only the entries after @p idx are moved on screen. The cursor stays on the 
+	 * entry it was over, or goes to the next one if that was removed.
+	 ***/
+	void
+	erase(const std::size_t idx);
+
+	/***
+	 * @brief Move an entry to another index, shifting the ones in between.
+	 * 
+	 * @param from       - Current index of the entry.
+	 * @param to         - New index of the entry.
+	 * 
+	 * Only the entries between @p from and @p to are moved on screen. The cursor 
+	 * stays on the entry it was over.
+	 ***/
+	void
+	move(const std::size_t from, const std::size_t to);
+
+	/***
+	 * @brief Get an entry.
+	 * 
+	 * @param idx        - Index of the entry.
+	 * 
+	 * @return The entry at @p idx.
+	 ***/
+	std::shared_ptr<MenuNode>
+	at(const std::size_t idx)
+	const;
+
+	/***
+	 * @brief Get the number of entries.
+	 * 
+	 * @return Number of entries.
+	 ***/
+	std::size_t
+	size()
+	const noexcept;
+
+	/***
+	 * @brief Get the index of the entry the cursor is over.
+	 * 
+	 * @return Index of the hovered entry, 0 if there are no entries.
+	 ***/
+	std::size_t
+	cursor()
+	const noexcept;
+
 	/***
 	 * @brief
 	 ***/
 	void
-	drawIt(sf::RenderWindow& window)
+	drawIt(RenderList& list)
 	const override;
 
 	/***
@@ -164,6 +230,24 @@ private:
 	moveCursor(const Direction dir)
 	noexcept;
 
+	/***
+	 * @brief Place entries at their spot in the grid.
+	 * 
+	 * @param first      - Index of the first entry to place.
+	 * @param last       - Index past the last entry to place.
+	 ***/
+	void
+	layout(const std::size_t first, const std::size_t last);
+
+	/***
+	 * @brief Get the size of a grid cell, including the spacing around an entry.
+	 * 
+	 * @return Width and height of a grid cell.
+	 ***/
+	XYPair
+	cellSize()
+	const noexcept;
+
 	/***
 	 * @brief Private attributes.
 	 ***/
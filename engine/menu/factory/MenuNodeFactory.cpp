@@ -23,12 +23,23 @@ MenuNodeFactory::setDefaultConfig(const std::string& file)
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 
+void
+MenuNodeFactory::setHeadless(const bool headless)
+noexcept
+{
+	headless_ = headless;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
 std::shared_ptr<MenuNode>
 MenuNodeFactory::create(const MenuNodeType type, const std::string& file) 
 const
 {
 	std::shared_ptr<MenuNode> entry = nullptr;
 	Config config = file.empty() ? config_default_ : parse(file);
+	config.font_.glyphs_ = !headless_;
 
 	switch (type) {
 		case MenuNodeType::Tree:
@@ -33,6 +33,16 @@ public:
 	void
 	setDefaultConfig(const std::string& file);
 
+	/***
+	 * @brief Tell whether there is no display, in which case the entries 
+	 * created next lay their captions out without rasterising any glyph.
+	 * 
+	 * @param headless    - Whether to run without a graphics context.
+	 ***/
+	void
+	setHeadless(const bool headless)
+	noexcept;
+
 	/***
 	 * @brief Create a menu entry using either a configuration file or the 
 	 * default configurations.
@@ -129,6 +139,9 @@ private:
 
 	///< Default menu configurations.
 	Config config_default_;
+
+	///< No graphics context to rasterise glyphs with.
+	bool headless_ = false;
 };
 
 }
\ No newline at end of file
@@ -19,6 +19,8 @@ GameObject::GameObject(
 	std::unique_ptr<Graphics>&& graphics
 )
 	: pos_(pos)
+	, prev_pos_(pos)
+	, alpha_(1.f)
 	, input_(std::move(input))
 	, physics_(std::move(physics))
 	, graphics_(std::move(graphics))
@@ -30,16 +32,101 @@ GameObject::GameObject(
 ////////////////////////////////////////////////////////////////////////////////
 
 void
-GameObject::update(sf::RenderWindow& window, const KeyAction action)
+GameObject::update(const KeyAction action)
+{
+	beginStep();
+	updateInput(action);
+	updatePhysics();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+void
+GameObject::beginStep()
+noexcept
+{
+	prev_pos_ = pos_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+void
+GameObject::updateInput(const KeyAction action)
 {
 	if (input_ != nullptr)
 		input_->update(*this, action);
-	
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+void
+GameObject::updatePhysics()
+{
 	if (physics_ != nullptr) 
 		physics_->update(*this);
-	
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+void
+GameObject::draw(RenderList& list, const float alpha)
+{
+	alpha_ = alpha;
+
 	if (graphics_ != nullptr)
-		graphics_->update(*this, window);	
+		graphics_->update(*this, list);	
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+XYPair
+GameObject::getPosition()
+const noexcept
+{
+	return pos_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+XYPair
+GameObject::getDrawPosition()
+const noexcept
+{
+	return prev_pos_ + (pos_ - prev_pos_) * alpha_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+XYPair
+GameObject::getPreviousPosition()
+const noexcept
+{
+	return prev_pos_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+void
+GameObject::setPosition(const XYPair& pos)
+noexcept
+{
+	pos_ = pos;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
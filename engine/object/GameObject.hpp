@@ -1,8 +1,8 @@
 #pragma once
 
 #include <memory>
-#include <SFML/Graphics/RenderWindow.hpp>
 
+#include "render/RenderList.hpp"
 #include "utility/type/Key.hpp"
 #include "utility/type/XY.hpp"
 
@@ -23,11 +23,88 @@ public:
 		std::unique_ptr<Graphics>&& graphics
 	);
 
+	/***
+	 * @brief Advance the object by one simulation step.
+	 * 
+	 * @param action      - Player input.
+	 ***/
 	void
-	update(sf::RenderWindow& window, const KeyAction action);
+	update(const KeyAction action);
+
+	/***
+	 * @brief Staged form of @property update, for updating many objects in 
+	 * parallel (see @property updateStaged). Calling the three methods in 
+	 * order is the same as calling @property update.
+	 * 
+	 * @property beginStep saves the current position as the previous one. 
+	 * Once every object has done so, the previous positions form a read-only 
+	 * snapshot of the world, and the Input and Physics stages can run on all 
+	 * objects at once as long as each component only writes its own object 
+	 * and reads other objects through @property getPreviousPosition.
+	 ***/
+	void
+	beginStep()
+	noexcept;
+
+	void
+	updateInput(const KeyAction action);
+
+	void
+	updatePhysics();
+
+	/***
+	 * @brief Record the object's draw calls.
+	 * 
+	 * @param list        - Render list for the current frame.
+	 * @param alpha       - How far, from 0 to 1, the frame is between the 
+	 *                      previous simulation step and the current one.
+	 ***/
+	void
+	draw(RenderList& list, const float alpha);
+
+	/***
+	 * @brief Get the object's position at the current simulation step.
+	 * 
+	 * @return Position.
+	 ***/
+	XYPair
+	getPosition()
+	const noexcept;
+
+	/***
+	 * @brief Get the object's position for the frame being drawn, interpolated 
+	 * between the previous simulation step and the current one.
+	 * 
+	 * @return Interpolated position.
+	 ***/
+	XYPair
+	getDrawPosition()
+	const noexcept;
+
+	/***
+	 * @brief Get the object's position at the previous simulation step, which 
+	 * doesn't change during a staged update.
+	 * 
+	 * @return Previous position.
+	 ***/
+	XYPair
+	getPreviousPosition()
+	const noexcept;
+
+	/***
+	 * @brief Move the object. Its previous position is left as it was, so a 
+	 * move made during a simulation step is still interpolated.
+	 * 
+	 * @param pos         - New position.
+	 ***/
+	void
+	setPosition(const XYPair& pos)
+	noexcept;
 
 protected:
 	XYPair pos_;
+	XYPair prev_pos_; ///< Position at the previous simulation step.
+	float  alpha_;    ///< Interpolation factor of the frame being drawn.
 	std::unique_ptr<Input>    input_;
 	std::unique_ptr<Physics>  physics_;
 	std::unique_ptr<Graphics> graphics_;
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <SFML/Graphics/RenderWindow.hpp>
+#include "render/RenderList.hpp"
 
 namespace nemo
 {
@@ -15,7 +15,7 @@ public:
 	= default;
 
 	virtual void 
-	update(GameObject& obj, sf::RenderWindow& window) 
+	update(GameObject& obj, RenderList& list) 
 	= 0;
 };
 
@@ -17,4 +17,8 @@ public:
 	update(GameObject& obj, const KeyAction action) = 0;
 };
 
+inline
+Input::~Input() 
+= default;
+
 }
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include <cstring>
+
+#include "StagedUpdate.hpp"
+#include "job/JobSystem.hpp"
+#include "object/GameObject.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+void
+updateStaged(
+	JobSystem& jobs, 
+	const std::vector<GameObject*>& objects, 
+	const KeyAction action)
+{
+	// Each stage is a barrier: the next one starts once all objects are done.
+	jobs.parallelFor(objects.size(), 0, 
+		[&objects](const std::size_t first, const std::size_t last) {
+			for (auto i = first; i < last; ++i) {
+				objects[i]->beginStep();
+			}
+		}
+	);
+
+	jobs.parallelFor(objects.size(), 0, 
+		[&objects, action](const std::size_t first, const std::size_t last) {
+			for (auto i = first; i < last; ++i) {
+				objects[i]->updateInput(action);
+			}
+		}
+	);
+
+	jobs.parallelFor(objects.size(), 0, 
+		[&objects](const std::size_t first, const std::size_t last) {
+			for (auto i = first; i < last; ++i) {
+				objects[i]->updatePhysics();
+			}
+		}
+	);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+std::uint64_t
+checksum(const std::vector<GameObject*>& objects)
+noexcept
+{
+	// FNV-1a over the bits of the coordinates.
+	auto hash = std::uint64_t(14695981039346656037ull);
+	const auto mix = [&hash](const float v) {
+		std::uint32_t bits;
+		std::memcpy(&bits, &v, sizeof(bits));
+		for (auto i = 0; i < 4; ++i) {
+			hash ^= (bits >> (i * 8)) & 0xff;
+			hash *= 1099511628211ull;
+		}
+	};
+
+	for (const auto obj : objects) {
+		const auto pos = obj->getPosition();
+		mix(float(pos.x_));
+		mix(float(pos.y_));
+	}
+
+	return hash;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+}
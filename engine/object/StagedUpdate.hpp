@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "utility/type/Key.hpp"
+
+namespace nemo
+{
+
+class GameObject;
+class JobSystem;
+
+/***
+ * @brief Advance objects by one simulation step, with the Input and Physics 
+ * stages spread over the job system's threads.
+ * 
+ * First every object saves its position (the read buffer), then the Input 
+ * stage runs on all objects, then the Physics stage. Components must only 
+ * write their own object and read others through 
+ * @property GameObject::getPreviousPosition. Under that rule no object sees 
+ * another's half-finished step, and the result is the same whatever the 
+ * number of threads.
+ * 
+ * @param jobs        - Job system to run the stages on.
+ * @param objects     - Objects to update.
+ * @param action      - Player input.
+ ***/
+void
+updateStaged(
+	JobSystem& jobs, 
+	const std::vector<GameObject*>& objects, 
+	const KeyAction action);
+
+/***
+ * @brief Hash the positions of objects, to check that two runs ended in the 
+ * same state.
+ * 
+ * @param objects     - Objects.
+ * 
+ * @return Checksum of the exact bits of every position, in order.
+ ***/
+std::uint64_t
+checksum(const std::vector<GameObject*>& objects)
+noexcept;
+
+}
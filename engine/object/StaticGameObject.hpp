@@ -0,0 +1,185 @@
+#pragma once
+
+#include <utility>
+
+#include "render/RenderList.hpp"
+#include "utility/type/Key.hpp"
+#include "utility/type/XY.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Components that do nothing, for objects without input, physics, or 
+ * graphics.
+ ***/
+struct NoInput
+{
+	template <typename Object>
+	void
+	update(Object&, const KeyAction)
+	noexcept
+	{
+	}
+};
+
+struct NoPhysics
+{
+	template <typename Object>
+	void
+	update(Object&)
+	noexcept
+	{
+	}
+};
+
+struct NoGraphics
+{
+	template <typename Object>
+	void
+	update(Object&, RenderList&)
+	noexcept
+	{
+	}
+};
+
+/***
+ * @brief Game object whose component types are known at compile time.
+ * 
+ * This is the counterpart of @class GameObject for objects of a single kind 
+ * that come in large numbers. The components are stored inline and called 
+ * without virtual dispatch or null checks, so a loop over a container of 
+ * these objects (see @property updateBatch) can be fully inlined and 
+ * vectorized. Objects of mixed kinds should keep using @class GameObject.
+ * 
+ * A component is any type with a non-virtual `update` taking the object 
+ * first, the same way the methods of @class Input, @class Physics, and 
+ * @class Graphics do. Components usually take the object as a template 
+ * parameter so they work with both kinds of objects.
+ ***/
+template <typename InputT, typename PhysicsT, typename GraphicsT>
+class StaticGameObject
+{
+public:
+	explicit
+	StaticGameObject(
+		const XYPair& pos,
+		InputT input = InputT(),
+		PhysicsT physics = PhysicsT(),
+		GraphicsT graphics = GraphicsT()
+	)
+		: pos_(pos)
+		, prev_pos_(pos)
+		, alpha_(1.f)
+		, input_(std::move(input))
+		, physics_(std::move(physics))
+		, graphics_(std::move(graphics))
+	{
+	}
+
+	/***
+	 * @brief Advance the object by one simulation step.
+	 * 
+	 * @param action      - Player input.
+	 ***/
+	void
+	update(const KeyAction action)
+	{
+		prev_pos_ = pos_;
+		input_.update(*this, action);
+		physics_.update(*this);
+	}
+
+	/***
+	 * @brief Record the object's draw calls.
+	 * 
+	 * @param list        - Render list for the current frame.
+	 * @param alpha       - How far, from 0 to 1, the frame is between the 
+	 *                      previous simulation step and the current one.
+	 ***/
+	void
+	draw(RenderList& list, const float alpha)
+	{
+		alpha_ = alpha;
+		graphics_.update(*this, list);
+	}
+
+	/***
+	 * @brief Get the object's position at the current simulation step.
+	 * 
+	 * @return Position.
+	 ***/
+	XYPair
+	getPosition()
+	const noexcept
+	{
+		return pos_;
+	}
+
+	/***
+	 * @brief Get the object's position for the frame being drawn, interpolated 
+	 * between the previous simulation step and the current one.
+	 * 
+	 * @return Interpolated position.
+	 ***/
+	XYPair
+	getDrawPosition()
+	const noexcept
+	{
+		return prev_pos_ + (pos_ - prev_pos_) * alpha_;
+	}
+
+	/***
+	 * @brief Move the object. Its previous position is left as it was, so a 
+	 * move made during a simulation step is still interpolated.
+	 * 
+	 * @param pos         - New position.
+	 ***/
+	void
+	setPosition(const XYPair& pos)
+	noexcept
+	{
+		pos_ = pos;
+	}
+
+protected:
+	XYPair    pos_;
+	XYPair    prev_pos_; ///< Position at the previous simulation step.
+	float     alpha_;    ///< Interpolation factor of the frame being drawn.
+	InputT    input_;
+	PhysicsT  physics_;
+	GraphicsT graphics_;
+};
+
+/***
+ * @brief Advance a batch of objects of the same kind by one simulation step.
+ * 
+ * @param objects     - Container of @class StaticGameObject.
+ * @param action      - Player input.
+ ***/
+template <typename Container>
+void
+updateBatch(Container& objects, const KeyAction action)
+{
+	for (auto& obj : objects) {
+		obj.update(action);
+	}
+}
+
+/***
+ * @brief Record the draw calls of a batch of objects of the same kind.
+ * 
+ * @param objects     - Container of @class StaticGameObject.
+ * @param list        - Render list for the current frame.
+ * @param alpha       - Interpolation factor of the frame.
+ ***/
+template <typename Container>
+void
+drawBatch(Container& objects, RenderList& list, const float alpha)
+{
+	for (auto& obj : objects) {
+		obj.draw(list, alpha);
+	}
+}
+
+}
@@ -0,0 +1,158 @@
+#include <algorithm>
+#include <boost/assert.hpp>
+
+#include "Broadphase.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	// Colliders added since the last sort above which it's cheaper to sort 
+	// from scratch than to insert them one by one.
+	constexpr std::size_t bulk_insert = 64;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+SweepAndPrune::insert(const ColliderId id, const Aabb& box)
+{
+	if (id >= boxes_.size()) {
+		boxes_.resize(id + 1);
+		live_.resize(id + 1, false);
+		slot_.resize(id + 1);
+	}
+
+	BOOST_ASSERT(!live_[id]);
+	boxes_[id] = box;
+	live_[id] = true;
+
+	// Appended out of order; the next sort moves them into place.
+	endpoints_.push_back({ box.min_x_, id, false });
+	endpoints_.push_back({ box.max_x_, id, true });
+	++inserted_;
+	++size_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+SweepAndPrune::update(const ColliderId id, const Aabb& box)
+{
+	BOOST_ASSERT(id < live_.size() && live_[id]);
+	boxes_[id] = box;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+SweepAndPrune::erase(const ColliderId id)
+{
+	BOOST_ASSERT(id < live_.size() && live_[id]);
+	live_[id] = false;
+
+	// Removing in place keeps the rest of the order for the next sort.
+	endpoints_.erase(
+		std::remove_if(endpoints_.begin(), endpoints_.end(), 
+			[id](const Endpoint& e) { return e.id_ == id; }),
+		endpoints_.end()
+	);
+	--size_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<ColliderPair>&
+SweepAndPrune::findPairs()
+{
+	for (auto& e : endpoints_) {
+		const auto& box = boxes_[e.id_];
+		e.value_ = e.is_max_ ? box.max_x_ : box.min_x_;
+	}
+
+	// Insertion sort: linear when the order barely changed since last frame. 
+	// Many new colliders at once are better sorted from scratch.
+	moves_ = 0;
+	if (inserted_ > bulk_insert) {
+		std::sort(endpoints_.begin(), endpoints_.end());
+		moves_ = endpoints_.size();
+	}
+	inserted_ = 0;
+
+	for (std::size_t i = 1; i < endpoints_.size(); ++i) {
+		const auto e = endpoints_[i];
+		auto j = i;
+
+		while (j > 0 && e < endpoints_[j - 1]) {
+			endpoints_[j] = endpoints_[j - 1];
+			--j;
+		}
+
+		endpoints_[j] = e;
+		moves_ += i - j;
+	}
+
+	// Sweep: a box overlaps on x with every box still open when it starts.
+	pairs_.clear();
+	active_.clear();
+
+	for (const auto& e : endpoints_) {
+		if (e.is_max_) {
+			const auto slot = slot_[e.id_];
+			active_[slot] = active_.back();
+			slot_[active_[slot].id_] = slot;
+			active_.pop_back();
+			continue;
+		}
+
+		const auto& box = boxes_[e.id_];
+		for (const auto& other : active_) {
+			if (box.min_y_ <= other.max_y_ && other.min_y_ <= box.max_y_) {
+				pairs_.push_back({ 
+					std::min(e.id_, other.id_), 
+					std::max(e.id_, other.id_) 
+				});
+			}
+		}
+
+		slot_[e.id_] = active_.size();
+		active_.push_back({ e.id_, box.min_y_, box.max_y_ });
+	}
+
+	// Each pair is found exactly once, by whichever box starts last; sorting 
+	// makes the order independent of how ties were broken.
+	std::sort(pairs_.begin(), pairs_.end());
+	return pairs_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+SweepAndPrune::size()
+const noexcept
+{
+	return size_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+SweepAndPrune::lastSortMoves()
+const noexcept
+{
+	return moves_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace nemo
+{
+
+/***
+ * @brief Identifier of a collider, e.g. the index of a @class Pool handle. 
+ * Ids are used to index arrays, so they should be small and dense.
+ ***/
+using ColliderId = std::uint32_t;
+
+/***
+ * @brief Axis-aligned bounding box, borders included.
+ ***/
+struct Aabb
+{
+	float min_x_;
+	float min_y_;
+	float max_x_;
+	float max_y_;
+
+	bool
+	overlaps(const Aabb& rhs)
+	const noexcept
+	{
+		return min_x_ <= rhs.max_x_ && rhs.min_x_ <= max_x_
+			&& min_y_ <= rhs.max_y_ && rhs.min_y_ <= max_y_;
+	}
+};
+
+/***
+ * @brief Two colliders whose boxes overlap, lower id first.
+ ***/
+struct ColliderPair
+{
+	ColliderId a_;
+	ColliderId b_;
+
+	bool
+	operator== (const ColliderPair& rhs)
+	const noexcept
+	{
+		return a_ == rhs.a_ && b_ == rhs.b_;
+	}
+
+	bool
+	operator< (const ColliderPair& rhs)
+	const noexcept
+	{
+		return a_ < rhs.a_ || (a_ == rhs.a_ && b_ < rhs.b_);
+	}
+};
+
+/***
+ * @brief Sweep-and-prune broadphase.
+ * 
+ * Keeps the boxes of all colliders, and finds the pairs whose boxes overlap, 
+ * so that only those need an exact (narrow-phase) test.
+ * 
+ * The box ends are kept sorted along the x axis. Since objects move little 
+ * between frames, the order from the previous frame is almost right, and an 
+ * insertion sort fixes it in close to linear time. A sweep over the sorted 
+ * ends then only compares boxes that overlap on x.
+ ***/
+class SweepAndPrune
+{
+public:
+	/***
+	 * @brief Add a collider.
+	 * 
+	 * @param id          - Collider not added yet.
+	 * @param box         - Its bounding box.
+	 ***/
+	void
+	insert(const ColliderId id, const Aabb& box);
+
+	/***
+	 * @brief Update the box of a collider.
+	 * 
+	 * @param id          - Collider.
+	 * @param box         - New bounding box.
+	 ***/
+	void
+	update(const ColliderId id, const Aabb& box);
+
+	/***
+	 * @brief Remove a collider.
+	 * 
+	 * @param id          - Collider.
+	 ***/
+	void
+	erase(const ColliderId id);
+
+	/***
+	 * @brief Find the overlapping pairs for the current boxes.
+	 * 
+	 * @return Each overlapping pair once, sorted. Valid until the next call.
+	 ***/
+	const std::vector<ColliderPair>&
+	findPairs();
+
+	/***
+	 * @brief Find the overlapping pairs and pass each to a narrow-phase test.
+	 * 
+	 * @param fn          - Callable taking the two collider ids.
+	 ***/
+	template <typename Fn>
+	void
+	forEachPair(Fn&& fn)
+	{
+		for (const auto& pair : findPairs()) {
+			fn(pair.a_, pair.b_);
+		}
+	}
+
+	/***
+	 * @brief Get the number of colliders.
+	 * 
+	 * @return Collider count.
+	 ***/
+	std::size_t
+	size()
+	const noexcept;
+
+	/***
+	 * @brief Get the number of moves the last sort needed, a measure of how 
+	 * much the scene changed.
+	 * 
+	 * @return Moves.
+	 ***/
+	std::size_t
+	lastSortMoves()
+	const noexcept;
+
+private:
+	/***
+	 * @brief One end of a box on the x axis.
+	 ***/
+	struct Endpoint
+	{
+		float      value_;
+		ColliderId id_;
+		bool       is_max_;
+
+		bool
+		operator< (const Endpoint& rhs)
+		const noexcept
+		{
+			// Starts come before ends at the same spot, so boxes that touch 
+			// count as overlapping.
+			return value_ < rhs.value_ 
+				|| (value_ == rhs.value_ && !is_max_ && rhs.is_max_);
+		}
+	};
+
+	/***
+	 * @brief Box open during the sweep, with its extent on y at hand.
+	 ***/
+	struct ActiveBox
+	{
+		ColliderId id_;
+		float      min_y_;
+		float      max_y_;
+	};
+
+	/***
+	 * @brief Private attributes.
+	 ***/
+	std::vector<Aabb>         boxes_;     ///< Boxes by id.
+	std::vector<bool>         live_;      ///< Whether each id is in use.
+	std::vector<Endpoint>     endpoints_; ///< Box ends, sorted along x.
+	std::vector<ActiveBox>    active_;    ///< Boxes open during the sweep.
+	std::vector<std::size_t>  slot_;      ///< Position of each id in active_.
+	std::vector<ColliderPair> pairs_;     ///< Result of the last sweep.
+	std::size_t               size_ = 0;     ///< Colliders.
+	std::size_t               inserted_ = 0; ///< Colliders added since sort.
+	std::size_t               moves_ = 0;    ///< Moves of the last sort.
+};
+
+}
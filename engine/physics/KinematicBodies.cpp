@@ -0,0 +1,130 @@
+#include <boost/assert.hpp>
+
+#include "KinematicBodies.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+KinematicBodies::KinematicBodies(const SimdLevel level)
+	: level_(level)
+{
+	BOOST_ASSERT(level_ <= detectSimd());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+KinematicBodies::add(const XYPair& pos, const XYPair& vel, const XYPair& accel)
+{
+	x_.push_back(float(pos.x_));
+	y_.push_back(float(pos.y_));
+	vx_.push_back(float(vel.x_));
+	vy_.push_back(float(vel.y_));
+	ax_.push_back(float(accel.x_));
+	ay_.push_back(float(accel.y_));
+	return x_.size() - 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+KinematicBodies::remove(const std::size_t index)
+{
+	BOOST_ASSERT(index < size());
+
+	for (auto array : { &x_, &y_, &vx_, &vy_, &ax_, &ay_ }) {
+		(*array)[index] = array->back();
+		array->pop_back();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+KinematicBodies::integrate(const float dt)
+{
+	const auto kernel = [this] {
+		switch (level_) {
+		case SimdLevel::AVX2: return integrateAvx2;
+		case SimdLevel::SSE2: return integrateSse2;
+		default:              return integrateScalar;
+		}
+	}();
+
+	kernel(
+		x_.data(), y_.data(), vx_.data(), vy_.data(), 
+		ax_.data(), ay_.data(), 
+		size(), dt);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+XYPair
+KinematicBodies::position(const std::size_t index)
+const noexcept
+{
+	return { XValue(x_[index]), YValue(y_[index]) };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+KinematicBodies::setVelocity(const std::size_t index, const XYPair& vel)
+noexcept
+{
+	vx_[index] = float(vel.x_);
+	vy_[index] = float(vel.y_);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+KinematicBodies::size()
+const noexcept
+{
+	return x_.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+SimdLevel
+KinematicBodies::level()
+const noexcept
+{
+	return level_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<float>&
+KinematicBodies::xs()
+const noexcept
+{
+	return x_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<float>&
+KinematicBodies::ys()
+const noexcept
+{
+	return y_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
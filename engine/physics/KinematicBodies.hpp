@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "physics/Simd.hpp"
+#include "utility/type/XY.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Positions, velocities, and accelerations of bodies with simple 
+ * kinematic motion, stored as one float array per coordinate.
+ * 
+ * The whole set is integrated in one call by a kernel chosen for the CPU at 
+ * run time. Every kernel performs the same IEEE operations on each body in 
+ * the same order (no fused multiply-add), so they all give bit-identical 
+ * results and replays stay deterministic across machines.
+ ***/
+class KinematicBodies
+{
+public:
+	/***
+	 * @brief Constructor.
+	 * 
+	 * @param level       - Instruction set to integrate with. Defaults to the 
+	 *                      best one the CPU supports.
+	 ***/
+	explicit
+	KinematicBodies(const SimdLevel level = detectSimd());
+
+	/***
+	 * @brief Add a body.
+	 * 
+	 * @param pos         - Position.
+	 * @param vel         - Velocity, per second.
+	 * @param accel       - Acceleration, per second squared.
+	 * 
+	 * @return Index of the body. It stays valid until a body is removed.
+	 ***/
+	std::size_t
+	add(const XYPair& pos, const XYPair& vel, const XYPair& accel = XYPair());
+
+	/***
+	 * @brief Remove a body. The last body takes its index.
+	 * 
+	 * @param index       - Body to remove.
+	 ***/
+	void
+	remove(const std::size_t index);
+
+	/***
+	 * @brief Advance all bodies: velocity += acceleration * dt, then 
+	 * position += velocity * dt.
+	 * 
+	 * @param dt          - Seconds.
+	 ***/
+	void
+	integrate(const float dt);
+
+	/***
+	 * @brief Get the position of a body.
+	 * 
+	 * @param index       - Body.
+	 * 
+	 * @return Position.
+	 ***/
+	XYPair
+	position(const std::size_t index)
+	const noexcept;
+
+	/***
+	 * @brief Set the velocity of a body.
+	 * 
+	 * @param index       - Body.
+	 * @param vel         - Velocity, per second.
+	 ***/
+	void
+	setVelocity(const std::size_t index, const XYPair& vel)
+	noexcept;
+
+	/***
+	 * @brief Get the number of bodies.
+	 * 
+	 * @return Body count.
+	 ***/
+	std::size_t
+	size()
+	const noexcept;
+
+	/***
+	 * @brief Get the instruction set in use.
+	 * 
+	 * @return Instruction set.
+	 ***/
+	SimdLevel
+	level()
+	const noexcept;
+
+	/***
+	 * @brief Raw arrays, for systems that read or write many bodies at once.
+	 ***/
+	const std::vector<float>&
+	xs()
+	const noexcept;
+
+	const std::vector<float>&
+	ys()
+	const noexcept;
+
+private:
+	/***
+	 * @brief Private attributes.
+	 ***/
+	SimdLevel          level_;
+	std::vector<float> x_;
+	std::vector<float> y_;
+	std::vector<float> vx_;
+	std::vector<float> vy_;
+	std::vector<float> ax_;
+	std::vector<float> ay_;
+};
+
+/***
+ * @brief Integration kernels, one per instruction set. The SIMD versions must 
+ * only be called if @property detectSimd reports support for them. On other 
+ * targets than x86 they run the scalar kernel.
+ * 
+ * @param x, y        - Positions.
+ * @param vx, vy      - Velocities.
+ * @param ax, ay      - Accelerations.
+ * @param n           - Number of bodies.
+ * @param dt          - Seconds.
+ ***/
+void
+integrateScalar(
+	float* x, float* y, float* vx, float* vy, 
+	const float* ax, const float* ay, 
+	const std::size_t n, const float dt)
+noexcept;
+
+void
+integrateSse2(
+	float* x, float* y, float* vx, float* vy, 
+	const float* ax, const float* ay, 
+	const std::size_t n, const float dt)
+noexcept;
+
+void
+integrateAvx2(
+	float* x, float* y, float* vx, float* vy, 
+	const float* ax, const float* ay, 
+	const std::size_t n, const float dt)
+noexcept;
+
+}
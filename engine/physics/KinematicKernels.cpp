@@ -0,0 +1,139 @@
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define NEMO_X86 1
+#include <immintrin.h>
+#endif
+
+#include "KinematicBodies.hpp"
+
+// GCC and Clang only emit AVX2 instructions in functions that ask for them. 
+// FMA is deliberately left out, so that the SIMD kernels round exactly like 
+// the scalar one.
+#if defined(__GNUC__)
+#define NEMO_TARGET_SSE2 __attribute__((target("sse2")))
+#define NEMO_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define NEMO_TARGET_SSE2
+#define NEMO_TARGET_AVX2
+#endif
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+integrateScalar(
+	float* x, float* y, float* vx, float* vy, 
+	const float* ax, const float* ay, 
+	const std::size_t n, const float dt)
+noexcept
+{
+	for (std::size_t i = 0; i < n; ++i) {
+		const auto dvx = ax[i] * dt;
+		const auto dvy = ay[i] * dt;
+		vx[i] = vx[i] + dvx;
+		vy[i] = vy[i] + dvy;
+
+		const auto dx = vx[i] * dt;
+		const auto dy = vy[i] * dt;
+		x[i] = x[i] + dx;
+		y[i] = y[i] + dy;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef NEMO_X86
+
+NEMO_TARGET_SSE2
+void
+integrateSse2(
+	float* x, float* y, float* vx, float* vy, 
+	const float* ax, const float* ay, 
+	const std::size_t n, const float dt)
+noexcept
+{
+	const auto step = _mm_set1_ps(dt);
+	std::size_t i = 0;
+
+	for (; i + 4 <= n; i += 4) {
+		const auto new_vx = _mm_add_ps(
+			_mm_loadu_ps(vx + i), _mm_mul_ps(_mm_loadu_ps(ax + i), step));
+		const auto new_vy = _mm_add_ps(
+			_mm_loadu_ps(vy + i), _mm_mul_ps(_mm_loadu_ps(ay + i), step));
+		_mm_storeu_ps(vx + i, new_vx);
+		_mm_storeu_ps(vy + i, new_vy);
+
+		_mm_storeu_ps(x + i, 
+			_mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(new_vx, step)));
+		_mm_storeu_ps(y + i, 
+			_mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(new_vy, step)));
+	}
+
+	integrateScalar(x + i, y + i, vx + i, vy + i, ax + i, ay + i, n - i, dt);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+NEMO_TARGET_AVX2
+void
+integrateAvx2(
+	float* x, float* y, float* vx, float* vy, 
+	const float* ax, const float* ay, 
+	const std::size_t n, const float dt)
+noexcept
+{
+	const auto step = _mm256_set1_ps(dt);
+	std::size_t i = 0;
+
+	for (; i + 8 <= n; i += 8) {
+		const auto new_vx = _mm256_add_ps(
+			_mm256_loadu_ps(vx + i), _mm256_mul_ps(_mm256_loadu_ps(ax + i), step));
+		const auto new_vy = _mm256_add_ps(
+			_mm256_loadu_ps(vy + i), _mm256_mul_ps(_mm256_loadu_ps(ay + i), step));
+		_mm256_storeu_ps(vx + i, new_vx);
+		_mm256_storeu_ps(vy + i, new_vy);
+
+		_mm256_storeu_ps(x + i, 
+			_mm256_add_ps(_mm256_loadu_ps(x + i), _mm256_mul_ps(new_vx, step)));
+		_mm256_storeu_ps(y + i, 
+			_mm256_add_ps(_mm256_loadu_ps(y + i), _mm256_mul_ps(new_vy, step)));
+	}
+
+	integrateScalar(x + i, y + i, vx + i, vy + i, ax + i, ay + i, n - i, dt);
+}
+
+#else
+
+void
+integrateSse2(
+	float* x, float* y, float* vx, float* vy, 
+	const float* ax, const float* ay, 
+	const std::size_t n, const float dt)
+noexcept
+{
+	integrateScalar(x, y, vx, vy, ax, ay, n, dt);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+integrateAvx2(
+	float* x, float* y, float* vx, float* vy, 
+	const float* ax, const float* ay, 
+	const std::size_t n, const float dt)
+noexcept
+{
+	integrateScalar(x, y, vx, vy, ax, ay, n, dt);
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
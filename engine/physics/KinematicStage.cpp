@@ -0,0 +1,87 @@
+#include <boost/assert.hpp>
+
+#include "KinematicStage.hpp"
+#include "object/GameObject.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+KinematicStage::KinematicStage(const SimdLevel level)
+	: bodies_(level)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+KinematicStage::attach(GameObject& obj, const XYPair& vel, const XYPair& accel)
+{
+	BOOST_ASSERT(index_.count(&obj) == 0);
+
+	index_[&obj] = bodies_.add(obj.getPosition(), vel, accel);
+	objects_.push_back(&obj);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+KinematicStage::detach(const GameObject& obj)
+{
+	const auto it = index_.find(&obj);
+	BOOST_ASSERT(it != index_.end());
+	const auto index = it->second;
+	index_.erase(it);
+
+	// The last body takes the removed body's place.
+	bodies_.remove(index);
+	objects_[index] = objects_.back();
+	objects_.pop_back();
+
+	if (index < objects_.size()) {
+		index_[objects_[index]] = index;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+KinematicStage::setVelocity(const GameObject& obj, const XYPair& vel)
+{
+	const auto it = index_.find(&obj);
+	BOOST_ASSERT(it != index_.end());
+	bodies_.setVelocity(it->second, vel);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+KinematicStage::update(const float dt)
+{
+	bodies_.integrate(dt);
+
+	for (std::size_t i = 0; i < objects_.size(); ++i) {
+		objects_[i]->setPosition(bodies_.position(i));
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+const KinematicBodies&
+KinematicStage::bodies()
+const noexcept
+{
+	return bodies_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
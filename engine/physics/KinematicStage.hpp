@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include "physics/KinematicBodies.hpp"
+#include "utility/type/XY.hpp"
+
+namespace nemo
+{
+
+class GameObject;
+
+/***
+ * @brief Batched physics stage for GameObjects with simple kinematic motion.
+ * 
+ * Objects attached to the stage are created without a Physics component, and 
+ * have their motion integrated for all of them at once by 
+ * @class KinematicBodies instead of by one virtual call each. The stage owns 
+ * the position of the objects attached to it.
+ * 
+ * Run @property update after the objects' own update each simulation step, so 
+ * that their previous positions are recorded first and drawing interpolates 
+ * correctly.
+ ***/
+class KinematicStage
+{
+public:
+	explicit
+	KinematicStage(const SimdLevel level = detectSimd());
+
+	/***
+	 * @brief Start moving an object. It must stay alive and at the same 
+	 * address until detached.
+	 * 
+	 * @param obj         - Object, starting from its current position.
+	 * @param vel         - Velocity, per second.
+	 * @param accel       - Acceleration, per second squared.
+	 ***/
+	void
+	attach(GameObject& obj, const XYPair& vel, const XYPair& accel = XYPair());
+
+	/***
+	 * @brief Stop moving an object.
+	 * 
+	 * @param obj         - Attached object.
+	 ***/
+	void
+	detach(const GameObject& obj);
+
+	/***
+	 * @brief Change the velocity of an object.
+	 * 
+	 * @param obj         - Attached object.
+	 * @param vel         - Velocity, per second.
+	 ***/
+	void
+	setVelocity(const GameObject& obj, const XYPair& vel);
+
+	/***
+	 * @brief Integrate all attached objects and write back their positions.
+	 * 
+	 * @param dt          - Seconds.
+	 ***/
+	void
+	update(const float dt);
+
+	/***
+	 * @brief Get the bodies of the attached objects.
+	 * 
+	 * @return Bodies.
+	 ***/
+	const KinematicBodies&
+	bodies()
+	const noexcept;
+
+private:
+	/***
+	 * @brief Private attributes.
+	 ***/
+	KinematicBodies          bodies_;
+	std::vector<GameObject*> objects_; ///< Object of each body.
+	std::unordered_map<const GameObject*, std::size_t> index_; 
+	///< Body of each object.
+};
+
+}
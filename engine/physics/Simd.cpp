@@ -0,0 +1,68 @@
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+#include "Simd.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+SimdLevel
+detectSimd()
+noexcept
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2")) {
+		return SimdLevel::AVX2;
+	}
+	if (__builtin_cpu_supports("sse2")) {
+		return SimdLevel::SSE2;
+	}
+	return SimdLevel::Scalar;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	int info[4];
+	__cpuid(info, 0);
+	const auto max_leaf = info[0];
+
+	__cpuid(info, 1);
+	const auto sse2 = (info[3] & (1 << 26)) != 0;
+	const auto osxsave = (info[2] & (1 << 27)) != 0;
+	const auto avx = (info[2] & (1 << 28)) != 0;
+
+	// AVX2 also needs the OS to save the upper halves of the YMM registers.
+	if (max_leaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+		__cpuidex(info, 7, 0);
+		if ((info[1] & (1 << 5)) != 0) {
+			return SimdLevel::AVX2;
+		}
+	}
+
+	return sse2 ? SimdLevel::SSE2 : SimdLevel::Scalar;
+#else
+	return SimdLevel::Scalar;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+const char*
+simdName(const SimdLevel level)
+noexcept
+{
+	switch (level) {
+	case SimdLevel::SSE2: return "SSE2";
+	case SimdLevel::AVX2: return "AVX2";
+	default:              return "scalar";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+namespace nemo
+{
+
+/***
+ * @brief Instruction sets the batched kernels have versions for, from least 
+ * to most capable.
+ ***/
+enum class SimdLevel {
+	Scalar = 0,
+	SSE2,
+	AVX2,
+
+	count
+};
+
+/***
+ * @brief Find the most capable instruction set the CPU and OS support.
+ * 
+ * @return Instruction set. Always Scalar on non-x86 targets.
+ ***/
+SimdLevel
+detectSimd()
+noexcept;
+
+/***
+ * @brief Get the name of an instruction set, for reports.
+ * 
+ * @param level       - Instruction set.
+ * 
+ * @return Name.
+ ***/
+const char*
+simdName(const SimdLevel level)
+noexcept;
+
+}
@@ -1,5 +1,8 @@
+#include <boost/assert.hpp>
+
 #include "MenuPlayer.hpp"
 #include "menu/application/titleMenu.hpp"
+#include "menu/composite/MenuTree.hpp"
 
 namespace nemo
 {
@@ -7,10 +10,22 @@ namespace nemo
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 
-MenuPlayer::MenuPlayer()
+MenuPlayer::MenuPlayer(ActionMap& map, const bool headless)
+	: map_(map)
 {
 	active_ = true;
-	current_entry_ = createTitleMenu();
+	current_entry_ = createTitleMenu(headless);
+	map_.push(InputContext::Menu);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+MenuPlayer::~MenuPlayer()
+{
+	if (active_) {
+		close();
+	}
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -27,14 +42,62 @@ const noexcept
 ////////////////////////////////////////////////////////////////////////////////
 
 void
-MenuPlayer::update(
-	const std::optional<KeyAction> key, 
-	sf::RenderWindow& window)
+MenuPlayer::update(const std::vector<TimedInput>& inputs)
+{
+	const auto menu = std::dynamic_pointer_cast<MenuTree>(current_entry_);
+	if (!menuIsOpened() || menu == nullptr) {
+		return;
+	}
+
+	for (const auto& input : inputs) {
+		switch (input.action_) {
+			case KeyAction::Up:
+				menu->cursorUp();
+				break;
+
+			case KeyAction::Down:
+				menu->cursorDown();
+				break;
+
+			case KeyAction::Left:
+				menu->cursorLeft();
+				break;
+
+			case KeyAction::Right:
+				menu->cursorRight();
+				break;
+
+			default:
+				break;
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+MenuPlayer::draw(RenderList& list)
+const
 {
 	if (menuIsOpened()) {
-		current_entry_->drawIt(window);
+		current_entry_->drawIt(list);
 	}
+}
 
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+MenuPlayer::close()
+noexcept
+{
+	BOOST_ASSERT(active_);
+	active_ = false;
+	map_.pop();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
 }
\ No newline at end of file
@@ -1,11 +1,13 @@
 #pragma once
 
 #include <memory>
-#include <optional>
+#include <vector>
 
+#include "key/ActionMap.hpp"
 #include "menu/composite/MenuNode.hpp"
 #include "menu/factory/MenuNodeFactory.hpp"
-#include "utility/type/Key.hpp"
+#include "loop/InputQueue.hpp"
+#include "render/RenderList.hpp"
 
 namespace nemo
 {
@@ -14,9 +16,23 @@ class MenuPlayer
 {
 public:
 	/***
-	 * @brief Constructs the menu portion of the engine.
+	 * @brief Constructs the menu portion of the engine, with the title menu 
+	 * opened.
+	 * 
+	 * @param map         - Key bindings. The menu context is current for as 
+	 *                      long as a menu is opened. Must outlive the player.
+	 * @param headless    - Whether to run without a graphics context.
+	 ***/
+	MenuPlayer(ActionMap& map, const bool headless);
+
+	/***
+	 * @brief Destroys the menu portion of the engine, leaving the menu 
+	 * context if a menu is still opened.
 	 ***/
-	MenuPlayer();
+	~MenuPlayer();
+
+	MenuPlayer(const MenuPlayer&) = delete;
+	MenuPlayer& operator=(const MenuPlayer&) = delete;
 
 	/***
 	 * @brief Indicates whether a menu is currently opened on-screen.
@@ -29,17 +45,36 @@ public:
 
 	/***
 	 * @brief Updates the state of the game and currently opened menu upon 
-	 * player input. Changes are reflected on the render window.
+	 * player input.
+	 * 
+	 * Each directional press, repeats included, moves the cursor by one 
+	 * entry. Entries have no action to run yet, so Select does nothing.
+	 * 
+	 * @param inputs      - Player inputs received during the simulation step.
+	 ***/
+	void
+	update(const std::vector<TimedInput>& inputs);
+
+	/***
+	 * @brief Records the currently opened menu into the frame's render list.
 	 * 
-	 * @param key         - Player input.
-	 * @param window      - Render window.
+	 * @param list        - Render list for the current frame.
 	 ***/
 	void
-	update(
-		const std::optional<KeyAction> key, 
-		sf::RenderWindow& window);
+	draw(RenderList& list)
+	const;
 
 private:
+	/***
+	 * @brief Close the opened menu, and go back to the context before it.
+	 ***/
+	void
+	close()
+	noexcept;
+
+	ActionMap& map_; ///< Key bindings, switched to the menu context while a 
+	// menu is opened.
+
 	bool active_; ///< This not only indicates whethr a menu is currently being 
 	// accessed, but it also dictates the state of menu operations. True means 
 	// that a menu is currently being accessed and that any player input will 
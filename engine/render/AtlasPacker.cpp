@@ -0,0 +1,219 @@
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <unordered_map>
+#include <SFML/Graphics/Image.hpp>
+
+#include "AtlasPacker.hpp"
+#include "nlohmann/json.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	constexpr auto padding = 1u;          // Edge pixels, against bleeding.
+	constexpr auto max_texture_size = 4096u; // Safe on most GPUs.
+	constexpr auto indent = 4;
+
+	bool
+	isImage(const std::filesystem::path& path)
+	{
+		auto ext = path.extension().string();
+		std::transform(ext.begin(), ext.end(), ext.begin(), 
+			[](const unsigned char c) { return char(std::tolower(c)); });
+		return ext == ".png" || ext == ".jpg" || ext == ".bmp" || ext == ".tga";
+	}
+
+	unsigned int
+	nextPowerOfTwo(const unsigned int v)
+	noexcept
+	{
+		auto p = 1u;
+		while (p < v) {
+			p *= 2;
+		}
+		return p;
+	}
+
+	/***
+	 * @brief Repeat the edge pixels of an image placed in the atlas into the 
+	 * padding around it, so that filtering at its edges blends with copies of 
+	 * its own pixels instead of transparent ones.
+	 ***/
+	void
+	extrude(
+		sf::Image& atlas, 
+		const sf::Image& image, 
+		const sf::Vector2u position)
+	{
+		const auto w = int(image.getSize().x);
+		const auto h = int(image.getSize().y);
+		const auto p = int(padding);
+		if (w == 0 || h == 0) {
+			return;
+		}
+
+		for (auto y = -p; y < h + p; ++y) {
+			for (auto x = -p; x < w + p; ++x) {
+				if (x >= 0 && x < w && y >= 0 && y < h) {
+					continue;
+				}
+
+				const auto edge = image.getPixel(
+					unsigned(std::clamp(x, 0, w - 1)), 
+					unsigned(std::clamp(y, 0, h - 1)));
+				atlas.setPixel(unsigned(int(position.x) + x), 
+					unsigned(int(position.y) + y), edge);
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+unsigned int
+packShelves(
+	const std::vector<sf::Vector2u>& sizes, 
+	const unsigned int width, 
+	const unsigned int padding, 
+	std::vector<sf::Vector2u>& positions)
+{
+	std::vector<std::size_t> order(sizes.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), 
+		[&sizes](const std::size_t a, const std::size_t b) {
+			return sizes[a].y > sizes[b].y;
+		}
+	);
+
+	positions.assign(sizes.size(), { 0, 0 });
+	auto x = 0u;
+	auto shelf_y = 0u;
+	auto shelf_height = 0u;
+
+	for (const auto i : order) {
+		const auto w = sizes[i].x + 2 * padding;
+		const auto h = sizes[i].y + 2 * padding;
+
+		if (x + w > width && x > 0) {
+			shelf_y += shelf_height;
+			shelf_height = 0;
+			x = 0;
+		}
+
+		positions[i] = { x + padding, shelf_y + padding };
+		x += w;
+		shelf_height = std::max(shelf_height, h);
+	}
+
+	return shelf_y + shelf_height;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+packAtlas(
+	const std::string& image_dir, 
+	const std::string& out_path, 
+	std::ostream& log)
+{
+	namespace fs = std::filesystem;
+
+	std::error_code ec;
+	std::vector<fs::path> files;
+	for (const auto& entry : fs::directory_iterator(image_dir, ec)) {
+		if (entry.is_regular_file() && isImage(entry.path())) {
+			files.push_back(entry.path());
+		}
+	}
+
+	if (ec || files.empty()) {
+		log << "no images found in " << image_dir << std::endl;
+		return false;
+	}
+
+	// Sorted names keep the output the same from one run to the next.
+	std::sort(files.begin(), files.end());
+
+	// Regions are named without the extension, so two images may not share 
+	// a name, e.g. hero.png and hero.jpg.
+	std::unordered_map<std::string, const fs::path*> names;
+	for (const auto& file : files) {
+		const auto [it, added] = names.try_emplace(file.stem().string(), &file);
+		if (!added) {
+			log << "both " << it->second->string() << " and " << file.string() 
+				<< " would be named " << it->first << std::endl;
+			return false;
+		}
+	}
+
+	std::vector<sf::Image> images(files.size());
+	std::vector<sf::Vector2u> sizes;
+	auto area = 0ull;
+	auto widest = 0u;
+
+	for (std::size_t i = 0; i < files.size(); ++i) {
+		if (!images[i].loadFromFile(files[i].string())) {
+			log << "cannot load " << files[i].string() << std::endl;
+			return false;
+		}
+
+		const auto size = images[i].getSize();
+		sizes.push_back(size);
+		area += std::uint64_t(size.x + 2 * padding) * (size.y + 2 * padding);
+		widest = std::max(widest, size.x + 2 * padding);
+	}
+
+	// Aim for a square-ish atlas with a power of two width.
+	const auto width = nextPowerOfTwo(std::max(
+		widest, unsigned(std::ceil(std::sqrt(double(area))))));
+	std::vector<sf::Vector2u> positions;
+	const auto height = packShelves(sizes, width, padding, positions);
+
+	if (width > max_texture_size || height > max_texture_size) {
+		log << "atlas would be " << width << "x" << height 
+			<< ", more than " << max_texture_size << "x" << max_texture_size 
+			<< "; split " << image_dir << " into smaller directories" 
+			<< std::endl;
+		return false;
+	}
+
+	sf::Image atlas;
+	atlas.create(width, height, sf::Color::Transparent);
+	nlohmann::json js;
+
+	for (std::size_t i = 0; i < files.size(); ++i) {
+		atlas.copy(images[i], positions[i].x, positions[i].y);
+		extrude(atlas, images[i], positions[i]);
+		js["regions"][files[i].stem().string()] = { 
+			positions[i].x, positions[i].y, sizes[i].x, sizes[i].y 
+		};
+	}
+
+	if (!atlas.saveToFile(out_path + ".png")) {
+		log << "cannot write " << out_path << ".png" << std::endl;
+		return false;
+	}
+
+	std::ofstream ofs(out_path + ".json");
+	ofs << std::setw(indent) << js << std::endl;
+
+	log << "packed " << files.size() << " images into " << out_path 
+		<< ".png (" << width << "x" << height << ")" << std::endl;
+	return bool(ofs);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
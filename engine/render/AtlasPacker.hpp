@@ -0,0 +1,51 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include <SFML/System/Vector2.hpp>
+
+namespace nemo
+{
+
+/***
+ * @brief Place rectangles in rows (shelves) of a fixed width, tallest first.
+ * 
+ * @param sizes       - Sizes of the rectangles.
+ * @param width       - Width to fit them in.
+ * @param padding     - Empty space to leave around each rectangle.
+ * @param positions   - Filled in with the top left corner of each rectangle.
+ * 
+ * @return Height used.
+ ***/
+unsigned int
+packShelves(
+	const std::vector<sf::Vector2u>& sizes, 
+	const unsigned int width, 
+	const unsigned int padding, 
+	std::vector<sf::Vector2u>& positions);
+
+/***
+ * @brief Build a texture atlas from the images in a directory, for 
+ * @class TextureAtlas to load.
+ * 
+ * This is an offline tool, run with `--pack-atlas <images> <output>`. It 
+ * writes <output>.png with the images packed together, and <output>.json with 
+ * the area of each image, named after its file without the extension. Two 
+ * images with the same name but different extensions are an error. The edge 
+ * pixels of each image are repeated into a border around it, so that 
+ * filtering never blends in its neighbours or transparency.
+ * 
+ * @param image_dir   - Directory of .png, .jpg, .bmp, and .tga images.
+ * @param out_path    - Path of the atlas files, without extension.
+ * @param log         - Stream to report progress and errors to.
+ * 
+ * @return True if the atlas was written, false otherwise.
+ ***/
+bool
+packAtlas(
+	const std::string& image_dir, 
+	const std::string& out_path, 
+	std::ostream& log);
+
+}
@@ -0,0 +1,134 @@
+#include <cmath>
+#include <boost/assert.hpp>
+
+#include "Camera.hpp"
+#include "utility/wrapper/sfVector2.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	// Fraction of the remaining distance to close over dt seconds.
+	float
+	easing(const float rate, const float dt)
+	noexcept
+	{
+		return rate <= 0.f ? 1.f : 1.f - std::exp(-rate * dt);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+Camera::Camera(const XYPair& size, const XYPair& center)
+	: size_(size)
+	, center_(center)
+	, target_(center)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+Camera::follow(const XYPair& target)
+noexcept
+{
+	target_ = target;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+Camera::setZoom(const float zoom)
+noexcept
+{
+	BOOST_ASSERT(zoom > 0.f);
+	target_zoom_ = zoom;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+Camera::setSmoothing(const float follow_rate, const float zoom_rate)
+noexcept
+{
+	follow_rate_ = follow_rate;
+	zoom_rate_ = zoom_rate;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+Camera::snap()
+noexcept
+{
+	center_ = target_;
+	zoom_ = target_zoom_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+Camera::update(const float dt)
+noexcept
+{
+	center_ = center_ + (target_ - center_) * easing(follow_rate_, dt);
+
+	// Ease the zoom geometrically, so zooming in and out feel the same.
+	zoom_ *= std::pow(target_zoom_ / zoom_, easing(zoom_rate_, dt));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+sf::View
+Camera::view()
+const
+{
+	return sf::View(sfVector2(center_), sfVector2(size_ * zoom_));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+Camera::visibleRect(XYPair& min, XYPair& max)
+const noexcept
+{
+	const auto half = size_ * (zoom_ / 2.f);
+	min = center_ - half;
+	max = center_ + half;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+XYPair
+Camera::getCenter()
+const noexcept
+{
+	return center_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+float
+Camera::getZoom()
+const noexcept
+{
+	return zoom_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
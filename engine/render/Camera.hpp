@@ -0,0 +1,126 @@
+#pragma once
+
+#include <SFML/Graphics/View.hpp>
+
+#include "utility/type/XY.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Moving, zooming view of the world.
+ * 
+ * The camera eases toward the point it follows and the zoom it's asked for, 
+ * at rates independent of the frame rate, and produces the @class sf::View to 
+ * draw the world through along with the rectangle it shows, for culling.
+ ***/
+class Camera
+{
+public:
+	/***
+	 * @brief Constructor.
+	 * 
+	 * @param size        - Size of the area shown at zoom 1, usually the 
+	 *                      window size.
+	 * @param center      - Point shown in the middle.
+	 ***/
+	explicit
+	Camera(const XYPair& size, const XYPair& center = XYPair());
+
+	/***
+	 * @brief Set the point the camera moves toward.
+	 * 
+	 * @param target      - Point to show in the middle.
+	 ***/
+	void
+	follow(const XYPair& target)
+	noexcept;
+
+	/***
+	 * @brief Set the zoom the camera eases toward.
+	 * 
+	 * @param zoom        - Size of the shown area relative to the base size. 
+	 *                      Above 1 shows more of the world, below 1 less.
+	 ***/
+	void
+	setZoom(const float zoom)
+	noexcept;
+
+	/***
+	 * @brief Set how fast the camera catches up. A rate of r closes about 
+	 * 1 - e^(-r) of the remaining distance per second; 0 means instantly.
+	 * 
+	 * @param follow_rate - Rate for the position.
+	 * @param zoom_rate   - Rate for the zoom.
+	 ***/
+	void
+	setSmoothing(const float follow_rate, const float zoom_rate)
+	noexcept;
+
+	/***
+	 * @brief Jump straight to the target position and zoom.
+	 ***/
+	void
+	snap()
+	noexcept;
+
+	/***
+	 * @brief Ease toward the target position and zoom.
+	 * 
+	 * @param dt          - Seconds since the last update.
+	 ***/
+	void
+	update(const float dt)
+	noexcept;
+
+	/***
+	 * @brief Get the view to draw the world through.
+	 * 
+	 * @return View.
+	 ***/
+	sf::View
+	view()
+	const;
+
+	/***
+	 * @brief Get the rectangle of the world the camera shows.
+	 * 
+	 * @param min         - Filled in with the top left corner.
+	 * @param max         - Filled in with the bottom right corner.
+	 ***/
+	void
+	visibleRect(XYPair& min, XYPair& max)
+	const noexcept;
+
+	/***
+	 * @brief Get the point shown in the middle.
+	 * 
+	 * @return Center.
+	 ***/
+	XYPair
+	getCenter()
+	const noexcept;
+
+	/***
+	 * @brief Get the current zoom.
+	 * 
+	 * @return Zoom.
+	 ***/
+	float
+	getZoom()
+	const noexcept;
+
+private:
+	/***
+	 * @brief Private attributes.
+	 ***/
+	XYPair size_;               ///< Shown area at zoom 1.
+	XYPair center_;             ///< Current center.
+	XYPair target_;             ///< Center being moved toward.
+	float  zoom_ = 1.f;         ///< Current zoom.
+	float  target_zoom_ = 1.f;  ///< Zoom being eased toward.
+	float  follow_rate_ = 8.f;  ///< Easing rate of the center.
+	float  zoom_rate_ = 4.f;    ///< Easing rate of the zoom.
+};
+
+}
@@ -0,0 +1,123 @@
+#include "NullBackend.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+NullBackend::NullBackend(const std::size_t frames)
+	: frame_limit_(frames)
+	, frames_     (0)
+	, draws_      (0)
+	, close_sent_ (false)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+NullBackend::pollEvent(sf::Event& event)
+{
+	if (close_sent_ || frame_limit_ == 0 || frames_ < frame_limit_) {
+		return false;
+	}
+
+	close_sent_ = true;
+	event.type = sf::Event::Closed;
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+NullBackend::waitEvent(sf::Event& event)
+{
+	// There is nothing that could send an event later, so never block.
+	return pollEvent(event);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+NullBackend::clear([[maybe_unused]] const sf::Color color)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+NullBackend::draw([[maybe_unused]] const sf::Drawable& drawable)
+{
+	draws_.fetch_add(1, std::memory_order_relaxed);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+NullBackend::setView([[maybe_unused]] const sf::View& view)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+NullBackend::resetView()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+NullBackend::display()
+{
+	frames_.fetch_add(1, std::memory_order_relaxed);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+NullBackend::setActive([[maybe_unused]] const bool active)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+NullBackend::close()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+NullBackend::frameCount()
+const noexcept
+{
+	return frames_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+NullBackend::drawCount()
+const noexcept
+{
+	return draws_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
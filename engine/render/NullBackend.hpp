@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include "render/RenderBackend.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Render backend with no display.
+ * 
+ * Draw calls are only counted; nothing touches OpenGL. This lets the whole 
+ * game loop run headless, as fast as it can, for benchmarks and soak tests on 
+ * machines without a display.
+ * 
+ * Since there is no window to close, the backend asks the game to quit on its 
+ * own once it has shown a set number of frames.
+ ***/
+class NullBackend : public RenderBackend
+{
+public:
+	/***
+	 * @brief Construct the backend.
+	 * 
+	 * @param frames      - Number of frames to show before sending a close 
+	 *                      event. 0 means never.
+	 ***/
+	explicit NullBackend(const std::size_t frames = 0);
+
+	bool
+	pollEvent(sf::Event& event)
+	override;
+
+	bool
+	waitEvent(sf::Event& event)
+	override;
+
+	void
+	clear(const sf::Color color)
+	override;
+
+	void
+	draw(const sf::Drawable& drawable)
+	override;
+
+	void
+	setView(const sf::View& view)
+	override;
+
+	void
+	resetView()
+	override;
+
+	void
+	display()
+	override;
+
+	void
+	setActive(const bool active)
+	override;
+
+	void
+	close()
+	override;
+
+	/***
+	 * @brief Get the number of frames shown so far.
+	 * 
+	 * @return Frame count.
+	 ***/
+	std::size_t
+	frameCount()
+	const noexcept;
+
+	/***
+	 * @brief Get the number of draw calls received so far.
+	 * 
+	 * @return Draw call count.
+	 ***/
+	std::size_t
+	drawCount()
+	const noexcept;
+
+private:
+	std::size_t              frame_limit_;  ///< Frames to show before quitting.
+	std::atomic<std::size_t> frames_;       ///< Frames shown.
+	std::atomic<std::size_t> draws_;        ///< Draw calls received.
+	bool                     close_sent_;   ///< The close event has been sent.
+};
+
+}
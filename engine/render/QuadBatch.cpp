@@ -0,0 +1,100 @@
+#include <cmath>
+
+#include "QuadBatch.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+QuadBatch::QuadBatch(const sf::Texture* texture)
+	: vertices_(sf::Quads)
+	, texture_(texture)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+QuadBatch::append(
+	const sf::IntRect& rect, 
+	const float x, 
+	const float y, 
+	const sf::Color& color)
+{
+	const auto w = float(rect.width);
+	const auto h = float(rect.height);
+	const auto u = float(rect.left);
+	const auto v = float(rect.top);
+
+	vertices_.append(sf::Vertex({ x,     y     }, color, { u,     v     }));
+	vertices_.append(sf::Vertex({ x + w, y     }, color, { u + w, v     }));
+	vertices_.append(sf::Vertex({ x + w, y + h }, color, { u + w, v + h }));
+	vertices_.append(sf::Vertex({ x,     y + h }, color, { u,     v + h }));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+QuadBatch::append(const sf::Sprite& sprite)
+{
+	const auto& rect = sprite.getTextureRect();
+	const auto& transform = sprite.getTransform();
+	const auto color = sprite.getColor();
+
+	const auto w = float(std::abs(rect.width));
+	const auto h = float(std::abs(rect.height));
+	const auto u = float(rect.left);
+	const auto v = float(rect.top);
+	const auto du = float(rect.width);
+	const auto dv = float(rect.height);
+
+	const auto corner = [&](const float x, const float y, sf::Vector2f uv) {
+		const auto pos = transform.transformPoint({ x, y });
+		vertices_.append(sf::Vertex(pos, color, uv));
+	};
+
+	corner(0.f, 0.f, { u,      v      });
+	corner(w,   0.f, { u + du, v      });
+	corner(w,   h,   { u + du, v + dv });
+	corner(0.f, h,   { u,      v + dv });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+const sf::Texture*
+QuadBatch::texture()
+const noexcept
+{
+	return texture_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+QuadBatch::size()
+const noexcept
+{
+	return vertices_.getVertexCount() / 4;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+QuadBatch::draw(sf::RenderTarget& target, sf::RenderStates states)
+const
+{
+	states.texture = texture_;
+	target.draw(vertices_, states);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
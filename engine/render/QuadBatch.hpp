@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+namespace nemo
+{
+
+/***
+ * @brief Textured quads drawn in a single draw call.
+ ***/
+class QuadBatch : public sf::Drawable
+{
+public:
+	/***
+	 * @brief Constructor.
+	 * 
+	 * @param texture     - Texture all quads sample from. It must outlive 
+	 *                      the batch.
+	 ***/
+	explicit
+	QuadBatch(const sf::Texture* texture = nullptr);
+
+	/***
+	 * @brief Add a quad.
+	 * 
+	 * @param rect        - Part of the texture to show, in pixels.
+	 * @param x, y        - Where to put the top left corner.
+	 * @param color       - Color to multiply the texture by.
+	 ***/
+	void
+	append(
+		const sf::IntRect& rect, 
+		const float x, 
+		const float y, 
+		const sf::Color& color);
+
+	/***
+	 * @brief Add a sprite as a quad, with its transform and color. The 
+	 * sprite's texture must be the batch's.
+	 * 
+	 * @param sprite      - Sprite.
+	 ***/
+	void
+	append(const sf::Sprite& sprite);
+
+	/***
+	 * @brief Get the texture the quads sample from.
+	 * 
+	 * @return Texture.
+	 ***/
+	const sf::Texture*
+	texture()
+	const noexcept;
+
+	/***
+	 * @brief Get the number of quads.
+	 * 
+	 * @return Quad count.
+	 ***/
+	std::size_t
+	size()
+	const noexcept;
+
+private:
+	void
+	draw(sf::RenderTarget& target, sf::RenderStates states)
+	const override;
+
+	sf::VertexArray    vertices_; ///< Four vertices per quad.
+	const sf::Texture* texture_;  ///< Shared texture.
+};
+
+}
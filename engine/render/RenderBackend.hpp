@@ -0,0 +1,106 @@
+#pragma once
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <SFML/Window/Event.hpp>
+
+namespace nemo
+{
+
+/***
+ * @brief Where frames end up, and where platform events come from.
+ * 
+ * The game loop and render thread only talk to this interface, so the engine 
+ * can run against a real window or against no display at all.
+ ***/
+class RenderBackend
+{
+public:
+	virtual
+	~RenderBackend()
+	= default;
+
+	/***
+	 * @brief Take the next pending platform event.
+	 * 
+	 * @param event       - Filled in with the event, if any.
+	 * 
+	 * @return True if an event was taken, false if there is none pending.
+	 ***/
+	virtual bool
+	pollEvent(sf::Event& event)
+	= 0;
+
+	/***
+	 * @brief Block until a platform event arrives and take it.
+	 * 
+	 * @param event       - Filled in with the event.
+	 * 
+	 * @return True if an event was taken, false on error.
+	 ***/
+	virtual bool
+	waitEvent(sf::Event& event)
+	= 0;
+
+	/***
+	 * @brief Start a new frame, with the default view.
+	 * 
+	 * @param color       - Background color.
+	 ***/
+	virtual void
+	clear(const sf::Color color)
+	= 0;
+
+	/***
+	 * @brief Draw something on the current frame.
+	 * 
+	 * @param drawable    - What to draw.
+	 ***/
+	virtual void
+	draw(const sf::Drawable& drawable)
+	= 0;
+
+	/***
+	 * @brief Set the part of the world that later draw calls of the frame 
+	 * are seen through.
+	 * 
+	 * @param view        - View.
+	 ***/
+	virtual void
+	setView(const sf::View& view)
+	= 0;
+
+	/***
+	 * @brief Go back to the default view, which every frame starts with.
+	 ***/
+	virtual void
+	resetView()
+	= 0;
+
+	/***
+	 * @brief Show the finished frame.
+	 ***/
+	virtual void
+	display()
+	= 0;
+
+	/***
+	 * @brief Make the backend's rendering context current on the calling 
+	 * thread, or release it.
+	 * 
+	 * @param active      - Whether to acquire or release the context.
+	 ***/
+	virtual void
+	setActive(const bool active)
+	= 0;
+
+	/***
+	 * @brief Shut the backend down. No more frames will be drawn.
+	 ***/
+	virtual void
+	close()
+	= 0;
+};
+
+}
@@ -0,0 +1,76 @@
+#include "RenderBuffer.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+RenderList&
+RenderBuffer::back()
+noexcept
+{
+	return lists_[back_];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderBuffer::publish()
+{
+	std::unique_lock lock(mutex_);
+
+	// The front list can only be replaced once the render thread is done 
+	// with it.
+	changed_.wait(lock, [this] { return closed_ || (!ready_ && !busy_); });
+
+	back_ ^= 1;
+	ready_ = true;
+	changed_.notify_all();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+const RenderList*
+RenderBuffer::acquire()
+{
+	std::unique_lock lock(mutex_);
+	changed_.wait(lock, [this] { return closed_ || ready_; });
+
+	if (closed_) {
+		return nullptr;
+	}
+
+	ready_ = false;
+	busy_ = true;
+	return &lists_[back_ ^ 1];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderBuffer::release()
+{
+	std::lock_guard lock(mutex_);
+	busy_ = false;
+	changed_.notify_all();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderBuffer::close()
+{
+	std::lock_guard lock(mutex_);
+	closed_ = true;
+	changed_.notify_all();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+#include "render/RenderList.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Pair of render lists shared between the simulation thread and the 
+ * render thread.
+ * 
+ * The simulation records the next frame into the back list while the render 
+ * thread submits the front one. Publishing a frame swaps the two, so a list is 
+ * never written and read at the same time, and the render thread only ever 
+ * sees complete frames.
+ ***/
+class RenderBuffer
+{
+public:
+	/***
+	 * @brief Get the list the simulation should record the next frame into.
+	 * 
+	 * Only the simulation thread may call this.
+	 * 
+	 * @return Back list.
+	 ***/
+	RenderList&
+	back()
+	noexcept;
+
+	/***
+	 * @brief Hand the back list over to the render thread.
+	 * 
+	 * If the render thread is still busy with the previous frame, this waits 
+	 * until it is done, so the simulation never runs more than one frame ahead.
+	 ***/
+	void
+	publish();
+
+	/***
+	 * @brief Wait for a published frame and take it.
+	 * 
+	 * Only the render thread may call this. Every call that returns a list must 
+	 * be followed by @property release once the frame has been submitted.
+	 * 
+	 * @return Published frame, or nullptr if the buffer has been closed.
+	 ***/
+	const RenderList*
+	acquire();
+
+	/***
+	 * @brief Give the frame taken by @property acquire back to the simulation.
+	 ***/
+	void
+	release();
+
+	/***
+	 * @brief Wake up the render thread and make @property acquire return 
+	 * nullptr from now on.
+	 ***/
+	void
+	close();
+
+private:
+	std::array<RenderList, 2> lists_;    ///< Front and back lists.
+	std::size_t             back_ = 0;   ///< Index of the back list.
+	bool                    ready_ = false;  ///< A frame is waiting to be taken.
+	bool                    busy_ = false;   ///< A frame is being submitted.
+	bool                    closed_ = false; ///< No more frames will come.
+	std::mutex              mutex_;      ///< Guards the flags above.
+	std::condition_variable changed_;    ///< Signals a change of the flags.
+};
+
+}
@@ -0,0 +1,159 @@
+#include <type_traits>
+#include <utility>
+
+#include "RenderList.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderList::draw(const sf::RectangleShape& drawable)
+{
+	commands_.emplace_back(drawable);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderList::draw(const sf::Text& drawable)
+{
+	commands_.emplace_back(drawable);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderList::draw(const sf::Sprite& drawable)
+{
+	commands_.emplace_back(drawable);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderList::draw(const sf::VertexArray& drawable)
+{
+	commands_.emplace_back(drawable);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderList::draw(const QuadBatch& drawable)
+{
+	commands_.emplace_back(drawable);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderList::draw(QuadBatch&& drawable)
+{
+	commands_.emplace_back(std::move(drawable));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderList::setView(const sf::View& view)
+{
+	commands_.emplace_back(view);
+	view_ = view;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderList::resetView()
+{
+	commands_.emplace_back(DefaultView());
+	view_.reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+const std::optional<sf::View>&
+RenderList::view()
+const noexcept
+{
+	return view_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderList::clear()
+noexcept
+{
+	commands_.clear();
+	view_.reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+RenderList::size()
+const noexcept
+{
+	return commands_.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderList::submit(RenderBackend& backend)
+const
+{
+	for (const auto& command : commands_) {
+		std::visit(
+			[&backend](const auto& command) {
+				using T = std::decay_t<decltype(command)>;
+
+				if constexpr (std::is_same_v<T, sf::View>) {
+					backend.setView(command);
+				}
+				else if constexpr (std::is_same_v<T, DefaultView>) {
+					backend.resetView();
+				}
+				else if constexpr (std::is_same_v<T, sf::Text>) {
+					const std::lock_guard lock(fontMutex());
+					backend.draw(command);
+				}
+				else {
+					backend.draw(command);
+				}
+			},
+			command
+		);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::mutex&
+RenderList::fontMutex()
+noexcept
+{
+	static std::mutex mutex;
+	return mutex;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
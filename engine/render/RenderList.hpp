@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <variant>
+#include <vector>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include "render/QuadBatch.hpp"
+#include "render/RenderBackend.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Change of view back to the backend's default view.
+ ***/
+struct DefaultView
+{
+};
+
+/***
+ * @brief A single draw call, holding its own copy of what to draw, or a change 
+ * of view for the draw calls after it.
+ ***/
+using RenderCommand = std::variant<
+	sf::RectangleShape,
+	sf::Text,
+	sf::Sprite,
+	sf::VertexArray,
+	QuadBatch,
+	sf::View,
+	DefaultView
+>;
+
+/***
+ * @brief Everything to draw in one frame, in drawing order.
+ * 
+ * The simulation records a frame into a list instead of drawing straight to 
+ * the window. Since each command is a copy, the list stays valid after the 
+ * simulation moves on, and can be submitted later or from another thread.
+ ***/
+class RenderList
+{
+public:
+	/***
+	 * @brief Record a draw call.
+	 * 
+	 * @param drawable    - What to draw.
+	 ***/
+	void draw(const sf::RectangleShape& drawable);
+	void draw(const sf::Text& drawable);
+	void draw(const sf::Sprite& drawable);
+	void draw(const sf::VertexArray& drawable);
+	void draw(const QuadBatch& drawable);
+	void draw(QuadBatch&& drawable);
+
+	/***
+	 * @brief Record a change of view. The draw calls recorded after it are 
+	 * seen through the new view; those before it through the default view or 
+	 * the previous change.
+	 * 
+	 * @param view        - View, e.g. from a @class Camera.
+	 ***/
+	void
+	setView(const sf::View& view);
+
+	/***
+	 * @brief Record a change of view back to the backend's default view, 
+	 * which every frame starts with.
+	 ***/
+	void
+	resetView();
+
+	/***
+	 * @brief Get the view the next draw calls will be seen through, so that a 
+	 * caller changing it can put it back afterwards.
+	 * 
+	 * @return Last recorded view, or nothing for the default view.
+	 ***/
+	const std::optional<sf::View>&
+	view()
+	const noexcept;
+
+	/***
+	 * @brief Remove all draw calls, keeping the allocated space for the next 
+	 * frame.
+	 ***/
+	void
+	clear()
+	noexcept;
+
+	/***
+	 * @brief Get the number of recorded commands.
+	 * 
+	 * @return Number of draw calls and view changes.
+	 ***/
+	std::size_t
+	size()
+	const noexcept;
+
+	/***
+	 * @brief Draw everything in the list, in the order it was recorded.
+	 * 
+	 * @param backend     - Where to draw.
+	 ***/
+	void
+	submit(RenderBackend& backend)
+	const;
+
+	/***
+	 * @brief Get the lock guarding every use of a font.
+	 * 
+	 * A font loads its glyphs lazily, the first time a text using them is 
+	 * measured or drawn. With threaded rendering, the simulation may measure 
+	 * a text while the render thread draws another with the same font, so 
+	 * both sides must hold this lock while doing so.
+	 * 
+	 * @return Font lock.
+	 ***/
+	static std::mutex&
+	fontMutex()
+	noexcept;
+
+private:
+	std::vector<RenderCommand> commands_; ///< Recorded draw calls.
+	std::optional<sf::View>    view_;     ///< Current view, if not default.
+};
+
+}
@@ -0,0 +1,243 @@
+#include <array>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "RenderQueue.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	// Low bits of the key, by command type.
+	enum Kind : std::uint16_t {
+		Shape = 0,
+		Vertices,
+		Batch,
+		Sprite,
+		Text,
+	};
+
+	// Map a float to 24 bits that sort in the same order.
+	std::uint64_t
+	depthBits(const float depth)
+	noexcept
+	{
+		std::uint32_t bits;
+		std::memcpy(&bits, &depth, sizeof(bits));
+		bits = (bits & 0x8000'0000u) ? ~bits : bits | 0x8000'0000u;
+		return bits >> 8;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderQueue::push(const sf::Sprite& drawable, std::uint8_t layer, float depth)
+{
+	push(RenderCommand(drawable), drawable.getTexture(), layer, depth);
+	keys_.back() |= Sprite;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderQueue::push(const sf::Text& drawable, std::uint8_t layer, float depth)
+{
+	push(RenderCommand(drawable), drawable.getFont(), layer, depth);
+	keys_.back() |= Text;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderQueue::push(
+	const sf::RectangleShape& drawable, 
+	std::uint8_t layer, 
+	float depth)
+{
+	push(RenderCommand(drawable), drawable.getTexture(), layer, depth);
+	keys_.back() |= Shape;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderQueue::push(const sf::VertexArray& drawable, std::uint8_t layer, float depth)
+{
+	push(RenderCommand(drawable), nullptr, layer, depth);
+	keys_.back() |= Vertices;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderQueue::push(QuadBatch&& drawable, std::uint8_t layer, float depth)
+{
+	const auto texture = drawable.texture();
+	push(RenderCommand(std::move(drawable)), texture, layer, depth);
+	keys_.back() |= Batch;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderQueue::flush(RenderList& list)
+{
+	radixSort();
+	stats_ = { commands_.size(), 0, 0 };
+
+	const void* bound = nullptr;
+	const auto bind = [this, &bound](const void* resource) {
+		if (resource != bound) {
+			++stats_.binds_;
+			bound = resource;
+		}
+		++stats_.draws_;
+	};
+
+	for (std::size_t i = 0; i < order_.size();) {
+		const auto index = order_[i];
+		auto& command = commands_[index];
+		bind(resources_[index]);
+
+		// Consecutive sprites with the same texture become one draw call.
+		if (std::holds_alternative<sf::Sprite>(command)) {
+			auto last = i + 1;
+			while (last < order_.size() 
+				&& std::holds_alternative<sf::Sprite>(commands_[order_[last]])
+				&& resources_[order_[last]] == resources_[index]) {
+				++last;
+			}
+
+			if (last - i > 1) {
+				QuadBatch batch(std::get<sf::Sprite>(command).getTexture());
+				for (auto j = i; j < last; ++j) {
+					batch.append(std::get<sf::Sprite>(commands_[order_[j]]));
+				}
+				list.draw(std::move(batch));
+				i = last;
+				continue;
+			}
+		}
+
+		std::visit(
+			[&list](auto& drawable) {
+				using T = std::decay_t<decltype(drawable)>;
+
+				if constexpr (std::is_same_v<T, sf::View>) {
+					list.setView(drawable);
+				}
+				else if constexpr (std::is_same_v<T, DefaultView>) {
+					list.resetView();
+				}
+				else {
+					list.draw(std::move(drawable));
+				}
+			},
+			command
+		);
+		++i;
+	}
+
+	commands_.clear();
+	resources_.clear();
+	keys_.clear();
+	resource_ids_.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+QueueStats
+RenderQueue::stats()
+const noexcept
+{
+	return stats_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderQueue::push(
+	RenderCommand&& command, 
+	const void* resource, 
+	const std::uint8_t layer, 
+	const float depth)
+{
+	// Ids are given in order of first use, so that the order is the same from 
+	// one run to the next, unlike pointer values.
+	auto resource_id = std::uint64_t(0);
+	if (resource != nullptr) {
+		const auto next = std::uint16_t(resource_ids_.size() + 1);
+		resource_id = resource_ids_.try_emplace(resource, next).first->second;
+	}
+
+	commands_.push_back(std::move(command));
+	resources_.push_back(resource);
+	keys_.push_back(
+		std::uint64_t(layer) << 56 
+		| depthBits(depth) << 32 
+		| resource_id << 16
+	);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderQueue::radixSort()
+{
+	const auto n = keys_.size();
+	order_.resize(n);
+	scratch_.resize(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		order_[i] = std::uint32_t(i);
+	}
+
+	// Count the bytes of all passes at once.
+	std::array<std::array<std::size_t, 256>, 8> counts{};
+	for (const auto key : keys_) {
+		for (auto pass = 0; pass < 8; ++pass) {
+			++counts[pass][(key >> (pass * 8)) & 0xff];
+		}
+	}
+
+	for (auto pass = 0; pass < 8; ++pass) {
+		auto& count = counts[pass];
+		const auto shift = pass * 8;
+
+		// A byte that's the same in every key doesn't change the order.
+		if (n == 0 || count[(keys_[0] >> shift) & 0xff] == n) {
+			continue;
+		}
+
+		auto offset = std::size_t(0);
+		for (auto& c : count) {
+			const auto bucket = c;
+			c = offset;
+			offset += bucket;
+		}
+
+		for (const auto index : order_) {
+			scratch_[count[(keys_[index] >> shift) & 0xff]++] = index;
+		}
+
+		order_.swap(scratch_);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "render/RenderList.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Number of commands, draw calls, and texture binds in a frame.
+ ***/
+struct QueueStats
+{
+	std::size_t commands_ = 0; ///< Commands queued.
+	std::size_t draws_    = 0; ///< Draw calls after merging.
+	std::size_t binds_    = 0; ///< Texture changes between draw calls.
+};
+
+/***
+ * @brief Collects a frame's draw commands in any order and records them 
+ * sorted by layer, depth, and texture, with as few state changes and draw 
+ * calls as possible.
+ * 
+ * Each command gets a 64-bit sort key:
+ * 
+ *     | layer (8) | depth (24) | texture (16) | kind (16) |
+ * 
+ * Layers and depths are drawn from lowest to highest. Among commands at the 
+ * same layer and depth, those sharing a texture (or font) end up next to 
+ * each other, and consecutive sprites with the same texture are merged into 
+ * a single @class QuadBatch. Commands with equal keys keep the order they 
+ * were queued in. The command pipeline has no shaders or blend modes, so the 
+ * lowest bits sort by command type instead, which keeps sprites together.
+ * 
+ * Depth outranks texture, so textures only group among commands of equal 
+ * depth. A continuous depth, such as a raw y coordinate, gives nearly every 
+ * command its own depth and defeats the batching; quantise it (e.g. to tile 
+ * rows) or use a constant per layer wherever the exact order doesn't matter.
+ * 
+ * Sorting is a radix sort over the keys, so a frame costs linear time in the 
+ * number of commands, and the queue's buffers are reused from frame to frame.
+ * 
+ * The queue is opt-in: menus record straight into the @class RenderList, 
+ * since their few draw calls must follow the tree's order and share one font.
+ ***/
+class RenderQueue
+{
+public:
+	/***
+	 * @brief Queue a command.
+	 * 
+	 * @param drawable    - What to draw.
+	 * @param layer       - Layer, e.g. background, world, HUD.
+	 * @param depth       - Order within the layer, e.g. the tile row for 
+	 *                      top-down scenes.
+	 ***/
+	void push(const sf::Sprite& drawable, std::uint8_t layer, float depth = 0.f);
+	void push(const sf::Text& drawable, std::uint8_t layer, float depth = 0.f);
+	void push(const sf::RectangleShape& drawable, std::uint8_t layer, 
+		float depth = 0.f);
+	void push(const sf::VertexArray& drawable, std::uint8_t layer, 
+		float depth = 0.f);
+	void push(QuadBatch&& drawable, std::uint8_t layer, float depth = 0.f);
+
+	/***
+	 * @brief Record the queued commands in sorted order, and empty the queue.
+	 * 
+	 * @param list        - Render list for the current frame.
+	 ***/
+	void
+	flush(RenderList& list);
+
+	/***
+	 * @brief Get the counts of the last flush.
+	 * 
+	 * @return Statistics.
+	 ***/
+	QueueStats
+	stats()
+	const noexcept;
+
+private:
+	/***
+	 * @brief Queue a command with its key.
+	 ***/
+	void
+	push(
+		RenderCommand&& command, 
+		const void* resource, 
+		const std::uint8_t layer, 
+		const float depth);
+
+	/***
+	 * @brief Sort order_ by keys_, least significant byte first.
+	 ***/
+	void
+	radixSort();
+
+	/***
+	 * @brief Private attributes.
+	 ***/
+	std::vector<RenderCommand>      commands_;  ///< Queued commands.
+	std::vector<const void*>        resources_; ///< Texture or font of each.
+	std::vector<std::uint64_t>      keys_;      ///< Sort key of each command.
+	std::vector<std::uint32_t>      order_;     ///< Command indices, sorted.
+	std::vector<std::uint32_t>      scratch_;   ///< Radix sort buffer.
+	std::unordered_map<const void*, std::uint16_t> resource_ids_; 
+	///< Small ids of this frame's textures and fonts, in order of first use.
+	QueueStats                      stats_;     ///< Counts of the last flush.
+};
+
+}
@@ -0,0 +1,76 @@
+#include "RenderThread.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+RenderThread::RenderThread(RenderBackend& backend, RenderBuffer& buffer)
+	: backend_(backend)
+	, buffer_(buffer)
+{
+	// A context can only be active on one thread at a time.
+	backend_.setActive(false);
+	thread_ = std::thread(&RenderThread::run, this);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+RenderThread::~RenderThread()
+{
+	stop();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderThread::stop()
+{
+	if (!thread_.joinable()) {
+		return;
+	}
+
+	buffer_.close();
+	thread_.join();
+	backend_.setActive(true);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+const TimeStats&
+RenderThread::timing()
+const noexcept
+{
+	return timing_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+RenderThread::run()
+{
+	backend_.setActive(true);
+
+	while (const auto frame = buffer_.acquire()) {
+		const auto start = SteadyClock::now();
+
+		backend_.clear(sf::Color::White);
+		frame->submit(backend_);
+		backend_.display();
+
+		timing_.record(SteadyClock::now() - start);
+		buffer_.release();
+	}
+
+	backend_.setActive(false);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <thread>
+
+#include "render/RenderBackend.hpp"
+#include "render/RenderBuffer.hpp"
+#include "utility/TimeStats.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Thread that owns the backend's rendering context and submits the 
+ * frames published by the simulation.
+ * 
+ * While the render thread clears, draws, and displays frame N, the simulation 
+ * thread is free to simulate and record frame N+1.
+ ***/
+class RenderThread
+{
+public:
+	/***
+	 * @brief Take over the backend's context and start rendering.
+	 * 
+	 * @param backend     - Where to draw. Events must still be polled from the 
+	 *                      thread that created it.
+	 * @param buffer      - Frames to render.
+	 ***/
+	RenderThread(RenderBackend& backend, RenderBuffer& buffer);
+
+	/***
+	 * @brief Stop rendering. See @property stop.
+	 ***/
+	~RenderThread();
+
+	RenderThread(const RenderThread&) = delete;
+	RenderThread& operator=(const RenderThread&) = delete;
+
+	/***
+	 * @brief Close the buffer, wait for the thread to finish, and give the 
+	 * backend's context back to the calling thread.
+	 ***/
+	void
+	stop();
+
+	/***
+	 * @brief Get how long the render thread took to submit and display each 
+	 * frame. Only safe to read once the thread has been stopped.
+	 * 
+	 * @return Frame timing.
+	 ***/
+	const TimeStats&
+	timing()
+	const noexcept;
+
+private:
+	/***
+	 * @brief Body of the render thread.
+	 ***/
+	void
+	run();
+
+	/***
+	 * @brief Private attributes.
+	 ***/
+	RenderBackend&    backend_; ///< Where to draw.
+	RenderBuffer&     buffer_; ///< Frames to render.
+	TimeStats         timing_; ///< Time spent per frame.
+	std::thread       thread_; ///< Render thread.
+};
+
+}
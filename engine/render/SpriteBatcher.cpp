@@ -0,0 +1,73 @@
+#include <algorithm>
+
+#include "SpriteBatcher.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+SpriteBatcher::add(
+	const AtlasRegion& region, 
+	const XYPair& pos, 
+	const std::int32_t layer, 
+	const sf::Color& color)
+{
+	// Flipping the sign bit makes signed layers sort correctly as unsigned.
+	const auto layer_bits = std::uint32_t(layer) ^ 0x8000'0000u;
+	const auto key = std::uint64_t(layer_bits) << 32 | region.atlas_;
+
+	sprites_.push_back({ 
+		key, std::uint32_t(sprites_.size()), region.texture_, region.rect_, 
+		float(pos.x_), float(pos.y_), color 
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+SpriteBatcher::flush(RenderList& list)
+{
+	std::sort(sprites_.begin(), sprites_.end(), 
+		[](const Sprite& lhs, const Sprite& rhs) {
+			return lhs.key_ < rhs.key_ 
+				|| (lhs.key_ == rhs.key_ && lhs.order_ < rhs.order_);
+		}
+	);
+
+	stats_ = { sprites_.size(), 0 };
+
+	for (auto first = sprites_.begin(); first != sprites_.end();) {
+		const auto last = std::find_if(first, sprites_.end(), 
+			[first](const Sprite& s) { return s.key_ != first->key_; });
+
+		QuadBatch batch(first->texture_);
+		for (auto it = first; it != last; ++it) {
+			batch.append(it->rect_, it->x_, it->y_, it->color_);
+		}
+
+		list.draw(std::move(batch));
+		++stats_.batches_;
+		first = last;
+	}
+
+	sprites_.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+BatchStats
+SpriteBatcher::stats()
+const noexcept
+{
+	return stats_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <SFML/Graphics/Color.hpp>
+
+#include "render/RenderList.hpp"
+#include "render/TextureAtlas.hpp"
+#include "utility/type/XY.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Number of draw calls a frame of sprites needed with and without 
+ * batching.
+ ***/
+struct BatchStats
+{
+	std::size_t sprites_ = 0; ///< Sprites, i.e. draw calls without batching.
+	std::size_t batches_ = 0; ///< Draw calls with batching.
+};
+
+/***
+ * @brief Collects the sprites of a frame and draws them in as few calls as 
+ * possible.
+ * 
+ * Sprites are sorted by layer, then by atlas, and each run of sprites with 
+ * the same layer and atlas becomes one @class QuadBatch. Layers are drawn in 
+ * increasing order; within a layer, sprites of the same atlas keep the order 
+ * they were added in, but the order between atlases is unspecified.
+ ***/
+class SpriteBatcher
+{
+public:
+	/***
+	 * @brief Queue a sprite for this frame.
+	 * 
+	 * @param region      - Image to draw.
+	 * @param pos         - Where to put its top left corner.
+	 * @param layer       - Layer, lower ones are drawn first.
+	 * @param color       - Color to multiply the image by.
+	 ***/
+	void
+	add(
+		const AtlasRegion& region, 
+		const XYPair& pos, 
+		const std::int32_t layer = 0, 
+		const sf::Color& color = sf::Color::White);
+
+	/***
+	 * @brief Record the queued sprites as batches, and empty the queue.
+	 * 
+	 * @param list        - Render list for the current frame.
+	 ***/
+	void
+	flush(RenderList& list);
+
+	/***
+	 * @brief Get the counts of the last flush.
+	 * 
+	 * @return Statistics.
+	 ***/
+	BatchStats
+	stats()
+	const noexcept;
+
+private:
+	struct Sprite
+	{
+		std::uint64_t      key_;     ///< Layer and atlas, for sorting.
+		std::uint32_t      order_;   ///< Order added in, to break ties.
+		const sf::Texture* texture_;
+		sf::IntRect        rect_;
+		float              x_;
+		float              y_;
+		sf::Color          color_;
+	};
+
+	/***
+	 * @brief Private attributes.
+	 ***/
+	std::vector<Sprite> sprites_; ///< Queued sprites.
+	BatchStats          stats_;   ///< Counts of the last flush.
+};
+
+}
@@ -0,0 +1,68 @@
+#include <atomic>
+#include <fstream>
+#include <boost/assert.hpp>
+
+#include "TextureAtlas.hpp"
+#include "nlohmann/json.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	std::atomic<std::uint32_t> next_atlas_id(0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+TextureAtlas::TextureAtlas(const std::string& path)
+	: id_(next_atlas_id++)
+{
+	BOOST_VERIFY(texture_.loadFromFile(path + ".png"));
+
+	std::ifstream ifs(path + ".json");
+	BOOST_ASSERT(ifs.is_open());
+	nlohmann::json js;
+	ifs >> js;
+
+	// Each region is [left, top, width, height].
+	for (const auto& item : js.at("regions").items()) {
+		const auto& rect = item.value();
+		regions_[item.key()] = sf::IntRect(
+			rect.at(0).get<int>(), 
+			rect.at(1).get<int>(), 
+			rect.at(2).get<int>(), 
+			rect.at(3).get<int>()
+		);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+AtlasRegion
+TextureAtlas::region(const std::string& name)
+const
+{
+	const auto it = regions_.find(name);
+	BOOST_ASSERT(it != regions_.end());
+	return { &texture_, id_, it->second };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+const sf::Texture&
+TextureAtlas::texture()
+const noexcept
+{
+	return texture_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
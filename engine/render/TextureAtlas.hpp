@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+namespace nemo
+{
+
+/***
+ * @brief Part of an atlas texture holding one image.
+ ***/
+struct AtlasRegion
+{
+	const sf::Texture* texture_; ///< Atlas texture.
+	std::uint32_t      atlas_;   ///< Id of the atlas, for sorting.
+	sf::IntRect        rect_;    ///< Area of the image, in pixels.
+};
+
+/***
+ * @brief Texture holding many images, with the area of each one.
+ * 
+ * Atlases are built offline by @property packAtlas from a directory of 
+ * images. Drawing images from the same atlas doesn't switch textures, which 
+ * lets a @class SpriteBatcher draw them all in one call.
+ ***/
+class TextureAtlas
+{
+public:
+	/***
+	 * @brief Load an atlas made by @property packAtlas.
+	 * 
+	 * @param path        - Path of the atlas files, without the .png or 
+	 *                      .json extension.
+	 ***/
+	explicit
+	TextureAtlas(const std::string& path);
+
+	TextureAtlas(const TextureAtlas&)
+	= delete;
+
+	TextureAtlas&
+	operator= (const TextureAtlas&)
+	= delete;
+
+	/***
+	 * @brief Get the region of an image.
+	 * 
+	 * This method generates an assertion error if there is no such image.
+	 * 
+	 * @param name        - Image file name, without its extension.
+	 * 
+	 * @return Region.
+	 ***/
+	AtlasRegion
+	region(const std::string& name)
+	const;
+
+	/***
+	 * @brief Get the atlas texture.
+	 * 
+	 * @return Texture.
+	 ***/
+	const sf::Texture&
+	texture()
+	const noexcept;
+
+private:
+	/***
+	 * @brief Private attributes.
+	 ***/
+	sf::Texture   texture_;
+	std::uint32_t id_;      ///< Unique among the atlases loaded.
+	std::unordered_map<std::string, sf::IntRect> regions_; ///< Images by name.
+};
+
+}
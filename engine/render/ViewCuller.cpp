@@ -0,0 +1,69 @@
+#include <algorithm>
+
+#include "ViewCuller.hpp"
+#include "object/GameObject.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+ViewCuller::ViewCuller(const SpatialIndex& index, const float margin)
+	: index_(index)
+	, margin_(margin)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+ViewCuller::draw(
+	const Camera& camera, 
+	const std::vector<GameObject*>& objects, 
+	RenderList& list, 
+	const float alpha)
+{
+	XYPair min, max;
+	camera.visibleRect(min, max);
+	const auto margin = XYPair(XValue(margin_), YValue(margin_));
+
+	visible_.clear();
+	index_.queryRect(min - margin, max + margin, visible_);
+
+	// Keep the scene's drawing order, so that overlapping objects stack the 
+	// same way whatever the camera does.
+	std::sort(visible_.begin(), visible_.end());
+
+	const auto previous = list.view();
+	list.setView(camera.view());
+	for (const auto id : visible_) {
+		objects[id]->draw(list, alpha);
+	}
+
+	if (previous) {
+		list.setView(*previous);
+	}
+	else {
+		list.resetView();
+	}
+
+	stats_.visible_ = visible_.size();
+	stats_.total_ = objects.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+CullStats
+ViewCuller::stats()
+const noexcept
+{
+	return stats_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
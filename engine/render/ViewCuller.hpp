@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "render/Camera.hpp"
+#include "render/RenderList.hpp"
+#include "spatial/SpatialIndex.hpp"
+
+namespace nemo
+{
+
+class GameObject;
+
+/***
+ * @brief Number of objects drawn and skipped in a frame.
+ ***/
+struct CullStats
+{
+	std::size_t visible_ = 0; ///< Objects whose Graphics ran.
+	std::size_t total_   = 0; ///< Objects in the scene.
+};
+
+/***
+ * @brief Draws only the objects a camera can see.
+ * 
+ * The visible objects are found with a rectangle query on a spatial index 
+ * of object positions, so a frame costs in proportion to what's on screen 
+ * rather than to the size of the level.
+ ***/
+class ViewCuller
+{
+public:
+	/***
+	 * @brief Constructor.
+	 * 
+	 * @param index       - Index of object positions, where each object's id 
+	 *                      is its index in the vector given to @property draw.
+	 * @param margin      - How far outside the view an object's position can 
+	 *                      be while part of it still shows: the size of the 
+	 *                      largest object plus the farthest it moves in a 
+	 *                      step, since drawing interpolates positions.
+	 ***/
+	ViewCuller(const SpatialIndex& index, const float margin);
+
+	/***
+	 * @brief Record the draw calls of the visible objects, in the order they 
+	 * appear in @p objects, seen through the camera's view. The list's view 
+	 * is put back afterwards, so later draw calls are unaffected.
+	 * 
+	 * @param camera      - Camera.
+	 * @param objects     - All objects of the scene.
+	 * @param list        - Render list for the current frame.
+	 * @param alpha       - Interpolation factor of the frame.
+	 ***/
+	void
+	draw(
+		const Camera& camera, 
+		const std::vector<GameObject*>& objects, 
+		RenderList& list, 
+		const float alpha);
+
+	/***
+	 * @brief Get the counts of the last frame drawn.
+	 * 
+	 * @return Statistics.
+	 ***/
+	CullStats
+	stats()
+	const noexcept;
+
+private:
+	/***
+	 * @brief Private attributes.
+	 ***/
+	const SpatialIndex&    index_;
+	float                  margin_;
+	std::vector<SpatialId> visible_; ///< Reused query result.
+	CullStats              stats_;   ///< Counts of the last frame.
+};
+
+}
@@ -0,0 +1,115 @@
+#include "WindowBackend.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+WindowBackend::WindowBackend(
+	const unsigned int width, 
+	const unsigned int height, 
+	const std::string& title)
+
+	: window_(sf::VideoMode(width, height), title)
+{
+	// The frame rate is left to the game loop's pacing.
+	window_.setKeyRepeatEnabled(false);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+WindowBackend::pollEvent(sf::Event& event)
+{
+	return window_.pollEvent(event);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+WindowBackend::waitEvent(sf::Event& event)
+{
+	return window_.waitEvent(event);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+WindowBackend::clear(const sf::Color color)
+{
+	window_.setView(window_.getDefaultView());
+	window_.clear(color);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+WindowBackend::draw(const sf::Drawable& drawable)
+{
+	window_.draw(drawable);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+WindowBackend::setView(const sf::View& view)
+{
+	window_.setView(view);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+WindowBackend::resetView()
+{
+	window_.setView(window_.getDefaultView());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+WindowBackend::display()
+{
+	window_.display();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+WindowBackend::setActive(const bool active)
+{
+	window_.setActive(active);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+WindowBackend::close()
+{
+	window_.close();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+sf::RenderWindow&
+WindowBackend::window()
+noexcept
+{
+	return window_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
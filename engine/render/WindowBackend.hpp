@@ -0,0 +1,78 @@
+#pragma once
+
+#include <string>
+#include <SFML/Graphics/RenderWindow.hpp>
+
+#include "render/RenderBackend.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Render backend that draws on an SFML window.
+ ***/
+class WindowBackend : public RenderBackend
+{
+public:
+	/***
+	 * @brief Open a window.
+	 * 
+	 * @param width       - Width in pixels.
+	 * @param height      - Height in pixels.
+	 * @param title       - Title bar text.
+	 ***/
+	WindowBackend(
+		const unsigned int width, 
+		const unsigned int height, 
+		const std::string& title);
+
+	bool
+	pollEvent(sf::Event& event)
+	override;
+
+	bool
+	waitEvent(sf::Event& event)
+	override;
+
+	void
+	clear(const sf::Color color)
+	override;
+
+	void
+	draw(const sf::Drawable& drawable)
+	override;
+
+	void
+	setView(const sf::View& view)
+	override;
+
+	void
+	resetView()
+	override;
+
+	void
+	display()
+	override;
+
+	void
+	setActive(const bool active)
+	override;
+
+	void
+	close()
+	override;
+
+	/***
+	 * @brief Get the underlying window.
+	 * 
+	 * @return Render window.
+	 ***/
+	sf::RenderWindow&
+	window()
+	noexcept;
+
+private:
+	sf::RenderWindow window_; ///< Render window.
+};
+
+}
@@ -0,0 +1,224 @@
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <utility>
+#include <vector>
+
+#include "SettingsService.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	constexpr auto extension = ".json";
+	constexpr auto temp_extension = ".json.tmp";
+	constexpr auto indent = 4;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+SettingsService::SettingsService(std::string directory, const Duration delay)
+	: directory_(std::move(directory))
+	, delay_(delay)
+	, urgent_(false)
+	, stop_(false)
+	, writes_(0)
+	, writer_([this]() { run(); })
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+SettingsService::~SettingsService()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		stop_ = true;
+	}
+
+	changed_.notify_one();
+	writer_.join();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+nlohmann::json
+SettingsService::load(const std::string& name)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (const auto it = documents_.find(name); it != documents_.cend()) {
+			return it->second.value_;
+		}
+	}
+
+	// Read without the lock, so that the writer isn't held up.
+	nlohmann::json js;
+	try {
+		std::ifstream ifs(std::filesystem::path(directory_) / (name + extension));
+		ifs.exceptions(std::ios::failbit | std::ios::badbit);
+		ifs >> js;
+	}
+	catch (const std::ios_base::failure& e) {
+		// No file yet, or it can't be read.
+		js = nlohmann::json();
+	}
+	catch (const nlohmann::json::exception& e) {
+		// Not valid json.
+		js = nlohmann::json();
+	}
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	return documents_.try_emplace(name, Document{ js }).first->second.value_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+SettingsService::store(const std::string& name, const nlohmann::json& document)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		auto [it, inserted] = documents_.try_emplace(name);
+		auto& doc = it->second;
+
+		if (!inserted && doc.value_ == document) {
+			// Nothing changed, nothing to save.
+			return;
+		}
+
+		doc.value_ = document;
+		++doc.version_;
+	}
+
+	changed_.notify_one();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+SettingsService::flush()
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	urgent_ = true;
+	changed_.notify_one();
+	saved_.wait(lock, [this]() { return !dirty(); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+SettingsService::writeCount()
+const noexcept
+{
+	return writes_.load(std::memory_order_relaxed);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+SettingsService::run()
+{
+	struct Pending
+	{
+		std::string    name_;
+		nlohmann::json value_;
+		std::uint64_t  version_;
+	};
+
+	std::vector<Pending> pending;
+	std::unique_lock<std::mutex> lock(mutex_);
+
+	while (true) {
+		changed_.wait(lock, [this]() { return stop_ || dirty(); });
+
+		// Let more changes pile up, unless someone is waiting on the save.
+		changed_.wait_for(lock, delay_, [this]() { return stop_ || urgent_; });
+		urgent_ = false;
+
+		pending.clear();
+		for (const auto& [name, doc] : documents_) {
+			if (doc.saved_ != doc.version_) {
+				pending.push_back({ name, doc.value_, doc.version_ });
+			}
+		}
+
+		// Write the snapshot without the lock, so that stores don't wait.
+		lock.unlock();
+		for (const auto& p : pending) {
+			if (write(p.name_, p.value_)) {
+				writes_.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+		lock.lock();
+
+		// A document that failed to save isn't retried until it changes 
+		// again, so that a read-only folder doesn't keep the thread busy.
+		for (const auto& p : pending) {
+			documents_[p.name_].saved_ = p.version_;
+		}
+		saved_.notify_all();
+
+		if (stop_ && !dirty()) {
+			break;
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+SettingsService::dirty()
+const noexcept
+{
+	for (const auto& [name, doc] : documents_) {
+		if (doc.saved_ != doc.version_) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+SettingsService::write(const std::string& name, const nlohmann::json& document)
+const
+{
+	namespace fs = std::filesystem;
+
+	const auto path = fs::path(directory_) / (name + extension);
+	const auto temp = fs::path(directory_) / (name + temp_extension);
+
+	std::error_code error;
+	fs::create_directories(directory_, error);
+
+	{
+		std::ofstream ofs(temp);
+		ofs << std::setw(indent) << document << std::endl;
+		if (!ofs) {
+			return false;
+		}
+	}
+
+	fs::rename(temp, path, error);
+	return !error;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
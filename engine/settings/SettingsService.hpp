@@ -0,0 +1,136 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "nlohmann/json.hpp"
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Settings of the whole program, e.g. the controls, kept in memory and 
+ * saved in the background.
+ * 
+ * Each document is a json file in the settings directory, read the first time 
+ * it's asked for. Storing a document only changes the copy in memory and marks 
+ * it dirty if it differs, so callers never wait on the disk. A writer thread 
+ * saves dirty documents a short delay after they change, so that a burst of 
+ * changes ends in a single write. Files are written next to the old ones and 
+ * then renamed over them, so a crash never leaves a half-written file.
+ ***/
+class SettingsService
+{
+public:
+	/***
+	 * @brief Start the writer thread.
+	 * 
+	 * @param directory   - Where the documents are stored.
+	 * @param delay       - Time to wait after a change before saving, to 
+	 *                      gather other changes.
+	 ***/
+	explicit
+	SettingsService(
+		std::string directory = "data/settings", 
+		const Duration delay = std::chrono::milliseconds(250));
+
+	/***
+	 * @brief Save what's dirty and stop the writer thread.
+	 ***/
+	~SettingsService();
+
+	SettingsService(const SettingsService&) = delete;
+	SettingsService& operator=(const SettingsService&) = delete;
+
+	/***
+	 * @brief Get a document, reading it from its file the first time.
+	 * 
+	 * @param name        - Name of the document, without extension.
+	 * 
+	 * @return Copy of the document. Null if there is no file or it isn't 
+	 * valid json.
+	 ***/
+	nlohmann::json
+	load(const std::string& name);
+
+	/***
+	 * @brief Replace a document. It is saved in the background if it changed.
+	 * 
+	 * @param name        - Name of the document, without extension.
+	 * @param document    - New contents.
+	 ***/
+	void
+	store(const std::string& name, const nlohmann::json& document);
+
+	/***
+	 * @brief Save the dirty documents now, and wait until they are written.
+	 ***/
+	void
+	flush();
+
+	/***
+	 * @brief Get the number of files written so far.
+	 * 
+	 * @return Number of saves.
+	 ***/
+	std::size_t
+	writeCount()
+	const noexcept;
+
+private:
+	/***
+	 * @brief A document and how far it has been saved.
+	 ***/
+	struct Document
+	{
+		nlohmann::json value_;       ///< Contents.
+		std::uint64_t  version_ = 0; ///< Incremented on each change.
+		std::uint64_t  saved_ = 0;   ///< Version last written.
+	};
+
+	/***
+	 * @brief Body of the writer thread.
+	 ***/
+	void
+	run();
+
+	/***
+	 * @brief Indicates whether a document needs saving. The lock must be held.
+	 ***/
+	bool
+	dirty()
+	const noexcept;
+
+	/***
+	 * @brief Write a document to a temporary file and rename it over the old 
+	 * one.
+	 * 
+	 * @return True if the file was replaced, false otherwise.
+	 ***/
+	bool
+	write(const std::string& name, const nlohmann::json& document)
+	const;
+
+	/***
+	 * @brief Private attributes.
+	 ***/
+	std::string                               directory_; ///< Settings folder.
+	Duration                                  delay_;     ///< Write-behind.
+	std::unordered_map<std::string, Document> documents_; ///< Loaded so far.
+	mutable std::mutex                        mutex_;     ///< Guards the rest.
+	std::condition_variable                   changed_;   ///< Wakes the writer.
+	std::condition_variable                   saved_;     ///< Wakes flushes.
+	bool                                      urgent_;    ///< Skip the delay.
+	bool                                      stop_;      ///< Writer must end.
+	std::atomic<std::size_t>                  writes_;    ///< Files written.
+	std::thread                               writer_;    ///< Saves documents.
+};
+
+}
@@ -0,0 +1,322 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <utility>
+#include <boost/assert.hpp>
+
+#include "LooseQuadtree.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+LooseQuadtree::LooseQuadtree(
+	const XYPair& min, 
+	const XYPair& max, 
+	const std::size_t leaf_size, 
+	const std::uint32_t max_depth,
+	const float looseness
+)
+	: min_x_(float(min.x_))
+	, min_y_(float(min.y_))
+	, max_x_(float(max.x_))
+	, max_y_(float(max.y_))
+	, leaf_size_(leaf_size)
+	, max_depth_(max_depth)
+	, looseness_(looseness)
+{
+	BOOST_ASSERT(min_x_ < max_x_ && min_y_ < max_y_);
+	BOOST_ASSERT(leaf_size_ > 0);
+	BOOST_ASSERT(max_depth_ <= max_depth_limit);
+	BOOST_ASSERT(looseness_ >= 1.f);
+
+	// The root is the smallest square around the world.
+	Node root;
+	root.cx_ = (min_x_ + max_x_) / 2.f;
+	root.cy_ = (min_y_ + max_y_) / 2.f;
+	root.half_ = std::max(max_x_ - min_x_, max_y_ - min_y_) / 2.f;
+	root.depth_ = 0;
+	nodes_.push_back(std::move(root));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+LooseQuadtree::insert(const SpatialId id, const XYPair& pos)
+{
+	if (id >= entries_.size()) {
+		entries_.resize(id + 1);
+	}
+
+	BOOST_ASSERT(!entries_[id].live_);
+	const auto x = float(pos.x_);
+	const auto y = float(pos.y_);
+	BOOST_ASSERT(contains(x, y));
+
+	entries_[id].live_ = true;
+	place({ id, x, y });
+	++size_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+LooseQuadtree::move(const SpatialId id, const XYPair& pos)
+{
+	BOOST_ASSERT(id < entries_.size() && entries_[id].live_);
+	const auto& entry = entries_[id];
+	auto& leaf = nodes_[entry.node_];
+
+	const auto x = float(pos.x_);
+	const auto y = float(pos.y_);
+	BOOST_ASSERT(contains(x, y));
+
+	// Stay in the leaf as long as the object is within its loose bounds.
+	const auto loose_half = leaf.half_ * looseness_;
+	if (std::abs(x - leaf.cx_) <= loose_half 
+		&& std::abs(y - leaf.cy_) <= loose_half) {
+		auto& item = leaf.items_[entry.slot_];
+		item.x_ = x;
+		item.y_ = y;
+		return;
+	}
+
+	unlink(entry);
+	place({ id, x, y });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+LooseQuadtree::erase(const SpatialId id)
+{
+	BOOST_ASSERT(id < entries_.size() && entries_[id].live_);
+
+	unlink(entries_[id]);
+	entries_[id].live_ = false;
+	--size_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+LooseQuadtree::queryRect(
+	const XYPair& min, 
+	const XYPair& max, 
+	std::vector<SpatialId>& out)
+const
+{
+	const auto min_x = float(min.x_);
+	const auto min_y = float(min.y_);
+	const auto max_x = float(max.x_);
+	const auto max_y = float(max.y_);
+
+	visit(min_x, min_y, max_x, max_y, [&](const Item& item) {
+		if (item.x_ >= min_x && item.x_ <= max_x 
+			&& item.y_ >= min_y && item.y_ <= max_y) {
+			out.push_back(item.id_);
+		}
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+LooseQuadtree::queryRadius(
+	const XYPair& center, 
+	const float radius, 
+	std::vector<SpatialId>& out)
+const
+{
+	const auto cx = float(center.x_);
+	const auto cy = float(center.y_);
+	const auto r2 = radius * radius;
+
+	visit(cx - radius, cy - radius, cx + radius, cy + radius, 
+		[&](const Item& item) {
+			const auto dx = item.x_ - cx;
+			const auto dy = item.y_ - cy;
+			if (dx * dx + dy * dy <= r2) {
+				out.push_back(item.id_);
+			}
+		}
+	);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+LooseQuadtree::size()
+const noexcept
+{
+	return size_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+LooseQuadtree::nodeCount()
+const noexcept
+{
+	return nodes_.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::uint32_t
+LooseQuadtree::leafAt(const float x, const float y)
+const noexcept
+{
+	auto index = std::uint32_t(0);
+
+	while (nodes_[index].first_child_ != no_node) {
+		const auto& node = nodes_[index];
+		index = node.first_child_ 
+			+ (x >= node.cx_ ? 1 : 0) 
+			+ (y >= node.cy_ ? 2 : 0);
+	}
+
+	return index;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+LooseQuadtree::place(const Item& item)
+{
+	const auto index = leafAt(item.x_, item.y_);
+	auto& leaf = nodes_[index];
+
+	entries_[item.id_].node_ = index;
+	entries_[item.id_].slot_ = std::uint32_t(leaf.items_.size());
+	leaf.items_.push_back(item);
+
+	if (leaf.items_.size() > leaf_size_ && leaf.depth_ < max_depth_) {
+		split(index);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+LooseQuadtree::split(const std::uint32_t index)
+{
+	const auto first = std::uint32_t(nodes_.size());
+	const auto cx = nodes_[index].cx_;
+	const auto cy = nodes_[index].cy_;
+	const auto half = nodes_[index].half_ / 2.f;
+	const auto depth = nodes_[index].depth_ + 1;
+
+	// Quadrants in the order @property leafAt expects them.
+	for (auto q = 0; q < 4; ++q) {
+		Node child;
+		child.cx_ = cx + (q & 1 ? half : -half);
+		child.cy_ = cy + (q & 2 ? half : -half);
+		child.half_ = half;
+		child.depth_ = depth;
+		nodes_.push_back(std::move(child));
+	}
+
+	const auto items = std::move(nodes_[index].items_);
+	nodes_[index].items_ = std::vector<Item>();
+	nodes_[index].first_child_ = first;
+
+	// Objects that drifted out of the node's bounds may land in other leaves.
+	for (const auto& item : items) {
+		const auto leaf = leafAt(item.x_, item.y_);
+		entries_[item.id_].node_ = leaf;
+		entries_[item.id_].slot_ = std::uint32_t(nodes_[leaf].items_.size());
+		nodes_[leaf].items_.push_back(item);
+	}
+
+	for (auto child = first; child < first + 4; ++child) {
+		if (nodes_[child].items_.size() > leaf_size_ && depth < max_depth_) {
+			split(child);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+LooseQuadtree::unlink(const Entry& entry)
+{
+	auto& items = nodes_[entry.node_].items_;
+
+	if (entry.slot_ + 1 != items.size()) {
+		items[entry.slot_] = items.back();
+		entries_[items[entry.slot_].id_].slot_ = entry.slot_;
+	}
+
+	items.pop_back();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename Fn>
+void
+LooseQuadtree::visit(
+	const float min_x, 
+	const float min_y, 
+	const float max_x, 
+	const float max_y, 
+	Fn&& fn)
+const
+{
+	// Each visited node pushes at most four children, so the stack never 
+	// holds more than three per level plus four.
+	std::array<std::uint32_t, 3 * max_depth_limit + 4> stack;
+	std::size_t top = 0;
+	stack[top++] = 0;
+
+	while (top > 0) {
+		const auto& node = nodes_[stack[--top]];
+		const auto loose_half = node.half_ * looseness_;
+
+		if (max_x < node.cx_ - loose_half || min_x > node.cx_ + loose_half 
+			|| max_y < node.cy_ - loose_half || min_y > node.cy_ + loose_half) {
+			continue;
+		}
+
+		if (node.first_child_ == no_node) {
+			for (const auto& item : node.items_) {
+				fn(item);
+			}
+			continue;
+		}
+
+		for (auto child = node.first_child_; child < node.first_child_ + 4; 
+			++child) {
+			stack[top++] = child;
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+bool
+LooseQuadtree::contains(const float x, const float y)
+const noexcept
+{
+	return x >= min_x_ && x <= max_x_ && y >= min_y_ && y <= max_y_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "spatial/SpatialIndex.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Adaptive quadtree with loose node bounds.
+ * 
+ * Leaves split into four when they hold too many objects, so crowded areas 
+ * get small nodes and empty areas cost nothing. This keeps queries fast when 
+ * objects are clustered, where a @class SpatialGrid would either have huge 
+ * cells in the crowds or a lot of empty cells elsewhere.
+ * 
+ * Each leaf accepts objects up to a multiple of its size beyond its own 
+ * bounds (its loose bounds), so an object moving around doesn't have to be 
+ * relocated until it has left the neighborhood of its leaf. Queries test 
+ * nodes against their loose bounds to account for this.
+ * 
+ * Positions must stay inside the bounds given at construction. Leaves are not 
+ * merged back when objects leave them.
+ ***/
+class LooseQuadtree : public SpatialIndex
+{
+public:
+	/***
+	 * @brief Deepest the tree can get.
+	 ***/
+	static constexpr std::uint32_t max_depth_limit = 16;
+
+	/***
+	 * @brief Constructor.
+	 * 
+	 * @param min         - Top left corner of the world.
+	 * @param max         - Bottom right corner of the world.
+	 * @param leaf_size   - Objects a leaf holds before it splits.
+	 * @param max_depth   - Deepest the tree can get, at most 
+	 *                      @property max_depth_limit.
+	 * @param looseness   - Size of a node's loose bounds, relative to its 
+	 *                      bounds. Must be at least 1.
+	 ***/
+	LooseQuadtree(
+		const XYPair& min, 
+		const XYPair& max, 
+		const std::size_t leaf_size = 16, 
+		const std::uint32_t max_depth = 10,
+		const float looseness = 1.5f
+	);
+
+	void
+	insert(const SpatialId id, const XYPair& pos)
+	override;
+
+	void
+	move(const SpatialId id, const XYPair& pos)
+	override;
+
+	void
+	erase(const SpatialId id)
+	override;
+
+	void
+	queryRect(
+		const XYPair& min, 
+		const XYPair& max, 
+		std::vector<SpatialId>& out)
+	const override;
+
+	void
+	queryRadius(
+		const XYPair& center, 
+		const float radius, 
+		std::vector<SpatialId>& out)
+	const override;
+
+	std::size_t
+	size()
+	const noexcept override;
+
+	/***
+	 * @brief Get the number of nodes in the tree.
+	 * 
+	 * @return Node count.
+	 ***/
+	std::size_t
+	nodeCount()
+	const noexcept;
+
+private:
+	static constexpr auto no_node = std::uint32_t(-1);
+
+	struct Item
+	{
+		SpatialId id_;
+		float     x_;
+		float     y_;
+	};
+
+	struct Node
+	{
+		float             cx_;     ///< Center.
+		float             cy_;
+		float             half_;   ///< Half the width of the (tight) bounds.
+		std::uint32_t     depth_;
+		std::uint32_t     first_child_ = no_node; ///< Four children in a row.
+		std::vector<Item> items_;  ///< Objects, if the node is a leaf.
+	};
+
+	/***
+	 * @brief Where an object is stored.
+	 ***/
+	struct Entry
+	{
+		std::uint32_t node_;
+		std::uint32_t slot_;         ///< Index in the leaf's items.
+		bool          live_ = false; ///< Whether the id is in the index.
+	};
+
+	/***
+	 * @brief Find the leaf whose bounds contain a point.
+	 ***/
+	std::uint32_t
+	leafAt(const float x, const float y)
+	const noexcept;
+
+	/***
+	 * @brief Add an object to the leaf containing it, splitting the leaf if it 
+	 * gets too full.
+	 ***/
+	void
+	place(const Item& item);
+
+	/***
+	 * @brief Turn a leaf into four children and spread its objects over them.
+	 ***/
+	void
+	split(const std::uint32_t node);
+
+	/***
+	 * @brief Remove an object from its leaf.
+	 ***/
+	void
+	unlink(const Entry& entry);
+
+	/***
+	 * @brief Call a function for every object in the leaves whose loose bounds 
+	 * overlap a rectangle.
+	 ***/
+	template <typename Fn>
+	void
+	visit(
+		const float min_x, 
+		const float min_y, 
+		const float max_x, 
+		const float max_y, 
+		Fn&& fn)
+	const;
+
+	/***
+	 * @brief Indicates whether a point is inside the world.
+	 ***/
+	bool
+	contains(const float x, const float y)
+	const noexcept;
+
+	/***
+	 * @brief Private attributes.
+	 ***/
+	std::vector<Node>  nodes_;      ///< Nodes; the root comes first.
+	std::vector<Entry> entries_;    ///< Object locations by id.
+	float              min_x_;      ///< World bounds.
+	float              min_y_;
+	float              max_x_;
+	float              max_y_;
+	std::size_t        leaf_size_;
+	std::uint32_t      max_depth_;
+	float              looseness_;
+	std::size_t        size_ = 0;   ///< Objects in the index.
+};
+
+}
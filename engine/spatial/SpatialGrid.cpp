@@ -0,0 +1,216 @@
+#include <cmath>
+#include <boost/assert.hpp>
+
+#include "SpatialGrid.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+SpatialGrid::SpatialGrid(const float cell_size)
+	: inv_cell_size_(1.f / cell_size)
+{
+	BOOST_ASSERT(cell_size > 0.f);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+SpatialGrid::insert(const SpatialId id, const XYPair& pos)
+{
+	if (id >= entries_.size()) {
+		entries_.resize(id + 1);
+	}
+
+	auto& entry = entries_[id];
+	BOOST_ASSERT(!entry.live_);
+
+	const auto x = float(pos.x_);
+	const auto y = float(pos.y_);
+	const auto key = keyOf(cellOf(x), cellOf(y));
+	auto& cell = cells_[key];
+
+	entry.cell_ = key;
+	entry.slot_ = std::uint32_t(cell.size());
+	entry.live_ = true;
+	cell.push_back({ id, x, y });
+	++size_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+SpatialGrid::move(const SpatialId id, const XYPair& pos)
+{
+	BOOST_ASSERT(id < entries_.size() && entries_[id].live_);
+	auto& entry = entries_[id];
+
+	const auto x = float(pos.x_);
+	const auto y = float(pos.y_);
+	const auto key = keyOf(cellOf(x), cellOf(y));
+
+	// Most moves stay in the same cell.
+	if (key == entry.cell_) {
+		auto& item = cells_.find(key)->second[entry.slot_];
+		item.x_ = x;
+		item.y_ = y;
+		return;
+	}
+
+	unlink(entry);
+
+	auto& cell = cells_[key];
+	entry.cell_ = key;
+	entry.slot_ = std::uint32_t(cell.size());
+	cell.push_back({ id, x, y });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+SpatialGrid::erase(const SpatialId id)
+{
+	BOOST_ASSERT(id < entries_.size() && entries_[id].live_);
+
+	unlink(entries_[id]);
+	entries_[id].live_ = false;
+	--size_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+SpatialGrid::queryRect(
+	const XYPair& min, 
+	const XYPair& max, 
+	std::vector<SpatialId>& out)
+const
+{
+	const auto min_x = float(min.x_);
+	const auto min_y = float(min.y_);
+	const auto max_x = float(max.x_);
+	const auto max_y = float(max.y_);
+
+	visit(min_x, min_y, max_x, max_y, [&](const Item& item) {
+		if (item.x_ >= min_x && item.x_ <= max_x 
+			&& item.y_ >= min_y && item.y_ <= max_y) {
+			out.push_back(item.id_);
+		}
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+SpatialGrid::queryRadius(
+	const XYPair& center, 
+	const float radius, 
+	std::vector<SpatialId>& out)
+const
+{
+	const auto cx = float(center.x_);
+	const auto cy = float(center.y_);
+	const auto r2 = radius * radius;
+
+	visit(cx - radius, cy - radius, cx + radius, cy + radius, 
+		[&](const Item& item) {
+			const auto dx = item.x_ - cx;
+			const auto dy = item.y_ - cy;
+			if (dx * dx + dy * dy <= r2) {
+				out.push_back(item.id_);
+			}
+		}
+	);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+SpatialGrid::size()
+const noexcept
+{
+	return size_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+std::int32_t
+SpatialGrid::cellOf(const float v)
+const noexcept
+{
+	return std::int32_t(std::floor(v * inv_cell_size_));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+SpatialGrid::CellKey
+SpatialGrid::keyOf(const std::int32_t col, const std::int32_t row)
+noexcept
+{
+	return CellKey(std::uint32_t(col)) << 32 | std::uint32_t(row);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename Fn>
+void
+SpatialGrid::visit(
+	const float min_x, 
+	const float min_y, 
+	const float max_x, 
+	const float max_y, 
+	Fn&& fn)
+const
+{
+	const auto first_col = cellOf(min_x);
+	const auto last_col = cellOf(max_x);
+	const auto first_row = cellOf(min_y);
+	const auto last_row = cellOf(max_y);
+
+	for (auto col = first_col; col <= last_col; ++col) {
+		for (auto row = first_row; row <= last_row; ++row) {
+			const auto cell = cells_.find(keyOf(col, row));
+			if (cell == cells_.end()) {
+				continue;
+			}
+
+			for (const auto& item : cell->second) {
+				fn(item);
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+SpatialGrid::unlink(const Entry& entry)
+{
+	// Cells are kept when they become empty, so that objects moving back and 
+	// forth don't allocate.
+	auto& cell = cells_.find(entry.cell_)->second;
+
+	if (entry.slot_ + 1 != cell.size()) {
+		cell[entry.slot_] = cell.back();
+		entries_[cell[entry.slot_].id_].slot_ = entry.slot_;
+	}
+
+	cell.pop_back();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
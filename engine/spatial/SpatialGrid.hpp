@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "spatial/SpatialIndex.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Spatial hash over a uniform grid.
+ * 
+ * The plane is cut into square cells, and each non-empty cell keeps the 
+ * positions of the objects in it. Only the cells a query overlaps are 
+ * visited, and a move only touches the index's storage when an object 
+ * crosses into another cell. The world doesn't need bounds.
+ * 
+ * This works best when objects are spread fairly evenly and the cell size is 
+ * about the size of a typical query. For very uneven distributions, see 
+ * @class LooseQuadtree.
+ ***/
+class SpatialGrid : public SpatialIndex
+{
+public:
+	/***
+	 * @brief Constructor.
+	 * 
+	 * @param cell_size   - Width and height of a cell.
+	 ***/
+	explicit
+	SpatialGrid(const float cell_size);
+
+	void
+	insert(const SpatialId id, const XYPair& pos)
+	override;
+
+	void
+	move(const SpatialId id, const XYPair& pos)
+	override;
+
+	void
+	erase(const SpatialId id)
+	override;
+
+	void
+	queryRect(
+		const XYPair& min, 
+		const XYPair& max, 
+		std::vector<SpatialId>& out)
+	const override;
+
+	void
+	queryRadius(
+		const XYPair& center, 
+		const float radius, 
+		std::vector<SpatialId>& out)
+	const override;
+
+	std::size_t
+	size()
+	const noexcept override;
+
+private:
+	using CellKey = std::uint64_t;
+
+	struct Item
+	{
+		SpatialId id_;
+		float     x_;
+		float     y_;
+	};
+
+	/***
+	 * @brief Where an object is stored.
+	 ***/
+	struct Entry
+	{
+		CellKey       cell_;
+		std::uint32_t slot_;         ///< Index in the cell's items.
+		bool          live_ = false; ///< Whether the id is in the index.
+	};
+
+	/***
+	 * @brief Get the column or row of the cell containing a coordinate.
+	 ***/
+	std::int32_t
+	cellOf(const float v)
+	const noexcept;
+
+	static CellKey
+	keyOf(const std::int32_t col, const std::int32_t row)
+	noexcept;
+
+	/***
+	 * @brief Call a function for every object in the cells overlapping a 
+	 * rectangle.
+	 ***/
+	template <typename Fn>
+	void
+	visit(
+		const float min_x, 
+		const float min_y, 
+		const float max_x, 
+		const float max_y, 
+		Fn&& fn)
+	const;
+
+	/***
+	 * @brief Remove an object from its cell.
+	 ***/
+	void
+	unlink(const Entry& entry);
+
+	/***
+	 * @brief Private attributes.
+	 ***/
+	float inv_cell_size_;
+	std::unordered_map<CellKey, std::vector<Item>> cells_; 
+	///< Cells that have held objects.
+	std::vector<Entry> entries_;  ///< Object locations by id.
+	std::size_t        size_ = 0; ///< Objects in the index.
+};
+
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "utility/type/XY.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Identifier of an object in a spatial index, e.g. the index of a 
+ * @class Pool handle or of an @struct Entity. Ids are used to index arrays, so 
+ * they should be small and dense.
+ ***/
+using SpatialId = std::uint32_t;
+
+/***
+ * @brief Index of object positions that answers which objects are near a 
+ * point or inside a rectangle without scanning every object.
+ * 
+ * Positions are kept up to date by calling @property move whenever an object 
+ * moves. Query results are appended to a caller-provided vector, so that 
+ * reusing the vector makes queries allocation-free.
+ ***/
+class SpatialIndex
+{
+public:
+	virtual
+	~SpatialIndex()
+	= default;
+
+	/***
+	 * @brief Add an object.
+	 * 
+	 * @param id          - Object not in the index yet.
+	 * @param pos         - Its position.
+	 ***/
+	virtual void
+	insert(const SpatialId id, const XYPair& pos) = 0;
+
+	/***
+	 * @brief Update the position of an object.
+	 * 
+	 * @param id          - Object in the index.
+	 * @param pos         - Its new position.
+	 ***/
+	virtual void
+	move(const SpatialId id, const XYPair& pos) = 0;
+
+	/***
+	 * @brief Remove an object.
+	 * 
+	 * @param id          - Object in the index.
+	 ***/
+	virtual void
+	erase(const SpatialId id) = 0;
+
+	/***
+	 * @brief Find the objects inside a rectangle, borders included.
+	 * 
+	 * @param min         - Top left corner.
+	 * @param max         - Bottom right corner.
+	 * @param out         - Vector to append the objects to, in no particular 
+	 *                      order.
+	 ***/
+	virtual void
+	queryRect(
+		const XYPair& min, 
+		const XYPair& max, 
+		std::vector<SpatialId>& out)
+	const = 0;
+
+	/***
+	 * @brief Find the objects within a distance of a point, borders included.
+	 * 
+	 * @param center      - Point.
+	 * @param radius      - Distance.
+	 * @param out         - Vector to append the objects to, in no particular 
+	 *                      order.
+	 ***/
+	virtual void
+	queryRadius(
+		const XYPair& center, 
+		const float radius, 
+		std::vector<SpatialId>& out)
+	const = 0;
+
+	/***
+	 * @brief Get the number of objects in the index.
+	 * 
+	 * @return Object count.
+	 ***/
+	virtual std::size_t
+	size()
+	const noexcept = 0;
+};
+
+}
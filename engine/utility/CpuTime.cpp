@@ -0,0 +1,48 @@
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <ctime>
+#endif
+
+#include "CpuTime.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+Duration
+processCpuTime()
+noexcept
+{
+#ifdef _WIN32
+	FILETIME creation, exit, kernel, user;
+	if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user)) {
+		return Duration::zero();
+	}
+
+	// FILETIMEs count 100 ns intervals.
+	const auto ticks = [](const FILETIME& ft) {
+		return (static_cast<unsigned long long>(ft.dwHighDateTime) << 32) 
+			| ft.dwLowDateTime;
+	};
+
+	using hundred_ns = std::chrono::duration<long long, std::ratio<1, 10'000'000>>;
+	return std::chrono::duration_cast<Duration>(
+		hundred_ns(ticks(kernel) + ticks(user)));
+#else
+	timespec ts;
+	if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts) != 0) {
+		return Duration::zero();
+	}
+
+	return std::chrono::duration_cast<Duration>(
+		std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec));
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Get the CPU time the process has used so far, across all threads and 
+ * in both user and kernel mode.
+ * 
+ * @return CPU time since the process started.
+ ***/
+Duration
+processCpuTime()
+noexcept;
+
+}
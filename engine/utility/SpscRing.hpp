@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace nemo
+{
+
+/***
+ * @brief Fixed-size queue between exactly one producer thread and one 
+ * consumer thread, without locks.
+ * 
+ * Each side only writes its own index, and publishes the slots it filled or 
+ * emptied with a release store that the other side reads with an acquire 
+ * load. The indices sit on their own cache lines so that the two threads 
+ * don't invalidate each other's on every operation.
+ * 
+ * @tparam T          - Element type, copied in and out.
+ * @tparam Capacity   - Number of slots, a power of two.
+ ***/
+template <typename T, std::size_t Capacity>
+class SpscRing
+{
+	static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, 
+		"The capacity must be a power of two.");
+
+public:
+	/***
+	 * @brief Add an element. Only the producer may call this.
+	 * 
+	 * @param value       - Element.
+	 * 
+	 * @return True if it was added, false if the ring is full.
+	 ***/
+	bool
+	push(const T& value)
+	noexcept
+	{
+		const auto tail = tail_.load(std::memory_order_relaxed);
+		if (tail - head_.load(std::memory_order_acquire) == Capacity) {
+			return false;
+		}
+
+		slots_[tail & (Capacity - 1)] = value;
+		tail_.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	/***
+	 * @brief Take the oldest element. Only the consumer may call this.
+	 * 
+	 * @param value       - Where to put the element.
+	 * 
+	 * @return True if an element was taken, false if the ring is empty.
+	 ***/
+	bool
+	pop(T& value)
+	noexcept
+	{
+		const auto head = head_.load(std::memory_order_relaxed);
+		if (head == tail_.load(std::memory_order_acquire)) {
+			return false;
+		}
+
+		value = slots_[head & (Capacity - 1)];
+		head_.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	/***
+	 * @brief Indicates whether the ring is empty. Exact only for the 
+	 * consumer; for the producer, it may have been emptied since.
+	 * 
+	 * @return True if yes, false otherwise.
+	 ***/
+	bool
+	empty()
+	const noexcept
+	{
+		return head_.load(std::memory_order_acquire) 
+			== tail_.load(std::memory_order_acquire);
+	}
+
+private:
+	static constexpr std::size_t cache_line = 64;
+
+	alignas(cache_line) std::atomic<std::size_t> head_{ 0 }; ///< Next to pop.
+	alignas(cache_line) std::atomic<std::size_t> tail_{ 0 }; ///< Next to push.
+	alignas(cache_line) std::array<T, Capacity>  slots_;     ///< Elements.
+};
+
+}
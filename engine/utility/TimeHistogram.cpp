@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+#include "TimeHistogram.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+	constexpr auto bar_width = 40;
+
+	// Exclusive upper bound of a bucket, in microseconds. Buckets under 4 are 
+	// one microsecond wide; the others are a quarter of their power of two.
+	std::chrono::microseconds
+	upperBound(const std::size_t bucket)
+	noexcept
+	{
+		if (bucket < 4) {
+			return std::chrono::microseconds(bucket + 1);
+		}
+
+		const auto octave = bucket / 4 + 1;
+		const auto quarter = bucket % 4;
+		return std::chrono::microseconds(std::int64_t(5 + quarter) << (octave - 2));
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+TimeHistogram::record(const Duration sample)
+noexcept
+{
+	using us = std::chrono::microseconds;
+	const auto micros = std::uint64_t(std::max<us::rep>(
+		0, std::chrono::duration_cast<us>(sample).count()));
+
+	auto bucket = std::size_t(micros);
+	if (micros >= 4) {
+		// Index of the highest set bit, i.e. floor(log2(micros)), and the two 
+		// bits after it.
+		auto octave = std::size_t(0);
+		for (auto v = micros >> 1; v != 0; v >>= 1) {
+			++octave;
+		}
+
+		const auto quarter = std::size_t(micros >> (octave - 2)) & 3;
+		bucket = 4 * (octave - 1) + quarter;
+	}
+
+	++buckets_[std::min(bucket, n_buckets - 1)];
+	++count_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+Duration
+TimeHistogram::percentile(const double fraction)
+const noexcept
+{
+	if (count_ == 0) {
+		return Duration::zero();
+	}
+
+	const auto rank = std::max<std::size_t>(
+		1, std::size_t(fraction * double(count_) + 0.5));
+	auto seen = std::size_t(0);
+
+	for (std::size_t b = 0; b < n_buckets; ++b) {
+		seen += buckets_[b];
+		if (seen >= rank) {
+			return upperBound(b);
+		}
+	}
+
+	return upperBound(n_buckets - 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+TimeHistogram::print(std::ostream& os, const char* what)
+const
+{
+	using ms = std::chrono::duration<double, std::milli>;
+
+	os << what << ": " << count_ << " samples, "
+		<< "p50 < " << ms(percentile(0.5)).count() << " ms, "
+		<< "p90 < " << ms(percentile(0.9)).count() << " ms, "
+		<< "p99 < " << ms(percentile(0.99)).count() << " ms" << std::endl;
+
+	const auto most = *std::max_element(buckets_.cbegin(), buckets_.cend());
+	for (std::size_t b = 0; b < n_buckets; ++b) {
+		if (buckets_[b] == 0) {
+			continue;
+		}
+
+		const auto width = std::max<std::size_t>(
+			1, buckets_[b] * bar_width / most);
+		os << "  < " << ms(upperBound(b)).count() << " ms: " 
+			<< std::string(width, '#') << " " << buckets_[b] << std::endl;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
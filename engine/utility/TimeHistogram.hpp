@@ -0,0 +1,60 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <ostream>
+
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Distribution of a series of measured durations, such as input 
+ * latencies, for the percentiles that an average and a maximum hide.
+ * 
+ * Samples are counted in microseconds, in buckets that split each power of two 
+ * into four, so a percentile is off by at most a quarter from 4 microseconds 
+ * up to about half a minute. Recording is constant time and the histogram 
+ * never allocates.
+ ***/
+struct TimeHistogram
+{
+	static constexpr std::size_t n_buckets = 96; ///< Last starts at ~29 s.
+
+	std::array<std::size_t, n_buckets> buckets_{}; ///< Samples per bucket.
+	std::size_t                        count_ = 0; ///< Number of samples.
+
+	/***
+	 * @brief Account for one sample.
+	 * 
+	 * @param sample      - Measured duration.
+	 ***/
+	void
+	record(const Duration sample)
+	noexcept;
+
+	/***
+	 * @brief Get the duration under which a fraction of the samples fall, 
+	 * rounded up to the end of its bucket.
+	 * 
+	 * @param fraction    - Between 0 and 1, e.g. 0.99 for the 99th percentile.
+	 * 
+	 * @return Upper bound, or zero if nothing has been measured.
+	 ***/
+	Duration
+	percentile(const double fraction)
+	const noexcept;
+
+	/***
+	 * @brief Print the percentiles and a bar per non-empty bucket.
+	 * 
+	 * @param os          - Stream to print to.
+	 * @param what        - Name of the measurement.
+	 ***/
+	void
+	print(std::ostream& os, const char* what)
+	const;
+};
+
+}
@@ -0,0 +1,35 @@
+#include <algorithm>
+
+#include "TimeStats.hpp"
+
+namespace nemo
+{
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+void
+TimeStats::record(const Duration sample)
+noexcept
+{
+	++count_;
+	total_ += sample;
+	max_ = std::max(max_, sample);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+Duration
+TimeStats::mean()
+const noexcept
+{
+	return count_ > 0 
+		? total_ / static_cast<Duration::rep>(count_) 
+		: Duration::zero();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+
+#include "utility/type/Time.hpp"
+
+namespace nemo
+{
+
+/***
+ * @brief Running statistics over a series of measured durations, such as 
+ * frame times or input latencies.
+ ***/
+struct TimeStats
+{
+	std::size_t count_ = 0;                ///< Number of samples.
+	Duration    total_ = Duration::zero(); ///< Sum of all samples.
+	Duration    max_   = Duration::zero(); ///< Longest sample.
+
+	/***
+	 * @brief Account for one sample.
+	 * 
+	 * @param sample      - Measured duration.
+	 ***/
+	void
+	record(const Duration sample)
+	noexcept;
+
+	/***
+	 * @brief Get the average sample.
+	 * 
+	 * @return Mean duration, or zero if nothing has been measured.
+	 ***/
+	Duration
+	mean()
+	const noexcept;
+};
+
+}
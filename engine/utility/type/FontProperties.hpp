@@ -28,6 +28,8 @@ struct FontProperties
 	std::shared_ptr<sf::Font> family_; ///< Font family.
 	unsigned int              size_;   ///< Font size.
 	Alignment               align_;  ///< Horizontal text alignment.
+	bool                      glyphs_ = true; ///< Glyphs can be rasterised, 
+	// which needs a graphics context. Otherwise, text is only estimated.
 
 	/***
 	 * @brief Construct font properties.
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <chrono>
+
+namespace nemo
+{
+
+///< Monotonic clock used for frame timing and input timestamps.
+using SteadyClock = std::chrono::steady_clock;
+
+///< Point in time on the steady clock.
+using TimePoint = SteadyClock::time_point;
+
+///< Span of time on the steady clock.
+using Duration = SteadyClock::duration;
+
+}
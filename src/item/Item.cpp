@@ -1,27 +0,0 @@
-#include "Item.hpp"
-
-namespace nemo
-{
-
-Item::Item(int id)
-	: m_id(id)
-{
-}
-
-
-Item::~Item()
-{
-}
-
-
-int Item::ID() const noexcept
-{
-	return m_id;
-}
-
-std::string Item::Name() const
-{
-	return m_name;
-}
-
-}
\ No newline at end of file
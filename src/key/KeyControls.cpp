@@ -1,3 +1,4 @@
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <boost/container/flat_map.hpp>
@@ -27,6 +28,7 @@ namespace {
 	constexpr auto key_pause  = "pause";
 
 	constexpr auto path = "data/settings/controls.json";
+	constexpr auto temp_path = "data/settings/controls.json.tmp";
 	constexpr auto indent = 4;
 }
 
@@ -52,6 +54,7 @@ KeyControls::KeyControls()
 			return a < b;
 		}
 	)
+	, dirty_(false)
 {
 	map_.reserve(static_cast<size_t>(KeyAction::count));
 	load();
@@ -63,7 +66,9 @@ KeyControls::KeyControls()
 
 KeyControls::~KeyControls()
 {
-	save();
+	if (dirty_) {
+		save();
+	}
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -89,16 +94,19 @@ KeyControls::load()
 			Cancel { js.at(key_cancel) },
 			Pause  { js.at(key_pause)  }
 		);
+		dirty_ = false;
 	}
 	catch (const std::ios_base::failure& e) {
 		// Some error trying to read the file.
-		// Use default controls.
+		// Use default controls, and write them out on exit.
 		set();
+		dirty_ = true;
 	}
 	catch (const nlohmann::json::out_of_range& e) {
 		// Cannot find a key name in the file.
-		// Use default controls.
+		// Use default controls, and write them out on exit.
 		set();
+		dirty_ = true;
 	}
 }
 
@@ -107,7 +115,7 @@ KeyControls::load()
 ////////////////////////////////////////////////////////////////////////////////
 
 void
-KeyControls::save() const
+KeyControls::save()
 {
 	nlohmann::json js;
 	
@@ -127,9 +135,18 @@ KeyControls::save() const
 		}
 	};
 
-	// Save it to the file.
-	std::ofstream ofs(path);
-	ofs << std::setw(indent) << js << std::endl;	
+	// Save it to a temporary file, then swap it in.
+	{
+		std::ofstream ofs(temp_path);
+		ofs << std::setw(indent) << js << std::endl;
+		if (!ofs) {
+			return;
+		}
+	}
+
+	std::error_code error;
+	std::filesystem::rename(temp_path, path, error);
+	dirty_ = bool(error);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -30,8 +30,8 @@ public:
 	 * \brief Destroy the controls.
 	 * 
 	 * Before the object is destroyed, it saves the key configurations to a JSON
-	 * file that the constructor will read off of next time. If the file doesn't
-	 * exist, it creates one.
+	 * file that the constructor will read off of next time, unless the file 
+	 * already holds them. If the file doesn't exist, it creates one.
 	 */
 	~KeyControls();
 	
@@ -42,8 +42,11 @@ public:
 
 	/**
 	 * \brief Updates the JSON file with the current key configurations.
+	 * 
+	 * The configurations are written to a temporary file first and then 
+	 * renamed over the old one, so a crash never leaves a half-written file.
 	 */
-	void save() const;
+	void save();
 
 	/**
 	 * \brief Get the control associated with an user event.
@@ -74,6 +77,9 @@ private:
 		std::function <bool (const Key&, const Key&)> 
 	> map_;
 
+	///< The controls differ from what the JSON file holds.
+	bool dirty_;
+
 	/**
 	 * \brief Set the current controls of the game.
 	 * 
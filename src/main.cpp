@@ -25,11 +25,8 @@ int main()
 	// Run the program as long as its window is open.
 	while (window.isOpen())
 	{
-		std::unique_ptr<nemo::State> new_state = nullptr;
-
-		// Check for pending events.
-		if (sf::Event event;
-			window.pollEvent(event))
+		// Handle every pending event, not just one per frame.
+		for (sf::Event event; window.pollEvent(event); )
 		{
 			switch (event.type) {
 				// These cases apply to any state of the game.
@@ -53,7 +50,12 @@ int main()
 
 				default:
 					// The other events depend on the current state of the game.
-					new_state = states.top()->handleEvent(event);
+					// A new state takes over the events that follow it.
+					if (auto new_state = states.top()->handleEvent(event);
+						new_state != nullptr)
+					{
+						states.push(std::move(new_state));
+					}
 					break;
 			}
 		}
@@ -61,10 +63,6 @@ int main()
 		// Update the render window.
 		states.top()->update(window);
 		window.display();
-
-		if (new_state != nullptr) {
-			states.push(std::move(new_state));
-		}
 	}
 
 	return EXIT_SUCCESS;
@@ -19,7 +19,21 @@ public:
 	update(sf::RenderWindow& window) = 0;
 
 protected:
-	KeyControls controls_;
+	/**
+	 * \brief Get the controls shared by every state.
+	 * 
+	 * States come and go, e.g. on every loss of focus, so they share one 
+	 * instance that reads the file once and rewrites it on exit only if it 
+	 * was missing or incomplete.
+	 */
+	static KeyControls&
+	sharedControls()
+	{
+		static KeyControls controls;
+		return controls;
+	}
+
+	KeyControls& controls_ = sharedControls();
 };
 
 }
\ No newline at end of file